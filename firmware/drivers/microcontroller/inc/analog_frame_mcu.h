@@ -0,0 +1,106 @@
+#ifndef ANALOG_FRAME_MCU_H
+#define ANALOG_FRAME_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup Analog_IO Analog IO
+ ** @{ */
+
+/** \brief De-interleaver for the ADC continuous mode DMA frames.
+ *
+ * The ADC continuous driver delivers conversion frames with the results of all the
+ * enabled channels interleaved (in the order of the conversion pattern). This module
+ * splits those frames into one block per channel, swapping between two buffers so
+ * that a completed block can be read while the next one is being filled.
+ *
+ * It has no dependencies on ESP-IDF, so it can be compiled and tested on the host.
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 16/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "analog_io_mcu.h"
+/*==================[macros]=================================================*/
+#define ADC_FRAME_CHANNELS		4			/*!< Number of analog inputs of the ESP-EDU */
+#define ADC_FRAME_RESULT_BYTES	4			/*!< Bytes per conversion result (ESP32-C6 output format type 2) */
+#define ADC_FRAME_DATA_MASK		0x0FFF		/*!< Conversion result: bits 0..11 */
+#define ADC_FRAME_CHANNEL_SHIFT	13			/*!< Channel number: bits 13..15 */
+#define ADC_FRAME_CHANNEL_MASK	0x07
+#define ADC_FRAME_UNIT_SHIFT	16			/*!< ADC unit: bit 16 */
+#define ADC_FRAME_UNIT_MASK		0x01
+/*==================[typedef]================================================*/
+/**
+ * @brief De-interleaver state
+ *
+ * All fields are initialized by AnalogFrameInit(). They should only be accessed trough
+ * the functions of this module.
+ */
+typedef struct {
+	uint8_t channel_mask;									/*!< Enabled channels (bit n = CHn) */
+	uint16_t length;										/*!< Samples per channel in each block */
+	uint16_t fill[ADC_FRAME_CHANNELS];						/*!< Samples already stored in the block being filled */
+	uint16_t *write[ADC_FRAME_CHANNELS];					/*!< Block being filled by the DMA frames */
+	uint16_t *read[ADC_FRAME_CHANNELS];						/*!< Last completed block */
+	uint16_t buffer[2][ADC_FRAME_CHANNELS][ADC_BLOCK_SIZE];	/*!< Storage for both blocks */
+	bool ready;												/*!< A completed block is waiting to be read */
+	uint32_t overruns;										/*!< Completed blocks lost because the previous one was not read */
+	uint32_t discarded;										/*!< Results discarded (disabled channel or other ADC unit) */
+} analog_frame_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize (or reset) a de-interleaver
+ *
+ * @param frame 		Pointer to de-interleaver state
+ * @param channel_mask 	Enabled channels (bit n = CHn)
+ * @param length 		Samples per channel in each block (max: ADC_BLOCK_SIZE)
+ */
+void AnalogFrameInit(analog_frame_t *frame, uint8_t channel_mask, uint16_t length);
+
+/**
+ * @brief Split a DMA frame into the per channel blocks
+ *
+ * When every enabled channel has completed its block, the block becomes readable and the
+ * next one starts filling. If the previous block was not released with AnalogFrameRelease()
+ * it is overwritten and an overrun is counted.
+ *
+ * @param frame 	Pointer to de-interleaver state
+ * @param data 		Raw DMA frame, as returned by the ADC continuous driver
+ * @param size 		Size of the frame in bytes
+ * @return Number of blocks completed while processing the frame
+ */
+uint16_t AnalogFrameParse(analog_frame_t *frame, const uint8_t *data, uint32_t size);
+
+/**
+ * @brief Get the last completed block of a channel
+ *
+ * @param frame 	Pointer to de-interleaver state
+ * @param channel 	Channel selected
+ * @return Pointer to the block (of lenght = length), NULL if the channel is not enabled
+ */
+uint16_t * AnalogFrameBlock(analog_frame_t *frame, adc_ch_t channel);
+
+/**
+ * @brief Mark the completed block as read
+ *
+ * @param frame 	Pointer to de-interleaver state
+ */
+void AnalogFrameRelease(analog_frame_t *frame);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* #ifndef ANALOG_FRAME_MCU_H */
+
+/*==================[end of file]============================================*/
@@ -21,11 +21,14 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 24/02/2024 | Document creation		                         						|
+ * | 16/10/2026 | Continuous (DMA) mode		                         					|
+ * | 16/10/2026 | Double buffered float blocks for continuous mode                     	|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include "stdint.h"
+#include "stdbool.h"
 /*==================[macros]=================================================*/
 typedef enum adc_ch {
 	CH0 = 0,				/*!< Channel 0 */
@@ -40,6 +43,8 @@ typedef enum adc_mode {
 } adc_mode_t;
 
 #define DAC	0    			/*!< DAC pin. Override CH0 declaration*/
+
+#define ADC_BLOCK_SIZE	128		/*!< Samples per channel delivered on each conversion end (only for continuous mode) */
 /*==================[typedef]================================================*/
 /**
  * @brief Analog inputs config structure
@@ -50,15 +55,31 @@ typedef struct {
 	adc_mode_t mode;		/*!< Mode: single read or continuous read */
 	void *func_p;			/*!< Pointer to callback function for convertion end (only for continuous mode) */
 	void *param_p;			/*!< Pointer to callback function parameters (only for continuous mode) */
-	uint16_t sample_frec;	/*!< Sample frequency min: 20kHz - max: 2MHz (only for continuous mode)  */
+	uint16_t sample_frec;	/*!< Sample frequency per channel in Hz. All the enabled channels together must stay between 611Hz and 83,3kHz (only for continuous mode)  */
 } analog_input_config_t;	
 
+/**
+ * @brief Block of samples acquired in continuous mode
+ * 
+ * The samples buffer belongs to the driver's double buffer: it can be processed in place 
+ * (filtered, windowed, etc.) until it is returned with AnalogInputGiveBlock().
+ */
+typedef struct {
+	float *samples;			/*!< ADC_BLOCK_SIZE calibrated samples (in mV) */
+	uint32_t sequence;		/*!< Block number since AnalogStartContinuous() (gaps mean lost blocks) */
+	int64_t timestamp;		/*!< Time at which the block was completed (in us, from esp_timer) */
+} analog_block_t;
+
 /*==================[external data declaration]==============================*/
 
 /*==================[external functions declaration]=========================*/
 /**
  * @brief Analog input initialization
  * 
+ * @note In continuous mode all the enabled channels are converted by the same ADC unit
+ * (round robin, using DMA) and share the sample frequency of the last initialized one.
+ * Single and continuous modes can't be used at the same time.
+ * 
  * @param config Analog inputs config structure
  * @return null
  */
@@ -83,6 +104,11 @@ void AnalogInputReadSingle(adc_ch_t channel, uint16_t *value);
 /**
  * @brief Start convertion for ADC module in continuous mode
  * 
+ * Adds the channel to the conversion pattern (restarting the conversion if other channels 
+ * were already running). Each time ADC_BLOCK_SIZE samples of every running channel are 
+ * available, the callback functions given in AnalogInputInit() are called (from a driver 
+ * task, not from an interrupt).
+ * 
  * @param channel Channel selected
  */
 void AnalogStartContinuous(adc_ch_t channel);
@@ -95,13 +121,59 @@ void AnalogStartContinuous(adc_ch_t channel);
 void AnalogStopContinuous(adc_ch_t channel);
 
 /**
- * @brief 
+ * @brief Read the last block converted in continuous mode
  * 
  * @param channel Channel selected.
- * @param values Read variable array
+ * @param values Read variable array (of lenght = ADC_BLOCK_SIZE, in mV)
  */
 void AnalogInputReadContinuous(adc_ch_t channel, uint16_t *values);
 
+/**
+ * @brief Number of blocks lost in continuous mode
+ * 
+ * A block is lost when it is completed before the previous one was released, that is, 
+ * when the callback functions take longer than the acquisition of a new block.
+ * 
+ * @return Number of lost blocks since the last call to AnalogStartContinuous()
+ */
+uint32_t AnalogInputGetOverruns(void);
+
+/**
+ * @brief Number of DMA pool overflows in continuous mode
+ * 
+ * The pool of the driver overflows when the frames are not read in time. Each overflow 
+ * drops a DMA frame (64 conversion results), not a whole block.
+ * 
+ * @return Number of pool overflows since the last call to AnalogStartContinuous()
+ */
+uint32_t AnalogInputGetPoolOverflows(void);
+
+/**
+ * @brief Take ownership of the last block converted in continuous mode
+ * 
+ * Each channel has two float buffers: while the caller owns one of them the driver fills 
+ * the other, so the block can be used without copying it. The calling task is woken as soon 
+ * as the block is completed; the hand-off latency can be measured as 
+ * esp_timer_get_time() - block->timestamp.
+ * 
+ * @note If the caller still owns a block of this channel, it is returned first. If a 
+ * completed block is not taken before the next one is ready, it is replaced by the new one 
+ * (the gap is visible in the sequence number).
+ * 
+ * @param channel Channel selected
+ * @param block Pointer to block descriptor to fill
+ * @param timeout_ms Maximum waiting time (in ms)
+ * @return true if a block was taken, false on timeout
+ */
+bool AnalogInputTakeBlock(adc_ch_t channel, analog_block_t *block, uint32_t timeout_ms);
+
+/**
+ * @brief Return a block taken with AnalogInputTakeBlock() to the driver
+ * 
+ * @param channel Channel selected
+ */
+void AnalogInputGiveBlock(adc_ch_t channel);
+
 /**
  * @brief Digital-to-Analog convert.
  * 
@@ -0,0 +1,104 @@
+/**
+ * @file analog_frame_mcu.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include "analog_frame_mcu.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static bool BlockComplete(analog_frame_t *frame){
+	for(uint8_t ch = 0; ch < ADC_FRAME_CHANNELS; ch++){
+		if((frame->channel_mask & (1 << ch)) && (frame->fill[ch] < frame->length)){
+			return false;
+		}
+	}
+	return true;
+}
+
+static void SwapBlocks(analog_frame_t *frame){
+	uint16_t *aux;
+	for(uint8_t ch = 0; ch < ADC_FRAME_CHANNELS; ch++){
+		aux = frame->read[ch];
+		frame->read[ch] = frame->write[ch];
+		frame->write[ch] = aux;
+		frame->fill[ch] = 0;
+	}
+	if(frame->ready){
+		frame->overruns++;
+	}
+	frame->ready = true;
+}
+/*==================[external functions definition]==========================*/
+void AnalogFrameInit(analog_frame_t *frame, uint8_t channel_mask, uint16_t length){
+	if(length > ADC_BLOCK_SIZE){
+		length = ADC_BLOCK_SIZE;
+	}
+	frame->channel_mask = channel_mask;
+	frame->length = length;
+	for(uint8_t ch = 0; ch < ADC_FRAME_CHANNELS; ch++){
+		frame->fill[ch] = 0;
+		frame->write[ch] = frame->buffer[0][ch];
+		frame->read[ch] = frame->buffer[1][ch];
+	}
+	memset(frame->buffer, 0, sizeof(frame->buffer));
+	frame->ready = false;
+	frame->overruns = 0;
+	frame->discarded = 0;
+}
+
+uint16_t AnalogFrameParse(analog_frame_t *frame, const uint8_t *data, uint32_t size){
+	uint16_t completed = 0;
+	uint32_t result;
+	uint8_t ch;
+	for(uint32_t i = 0; i + ADC_FRAME_RESULT_BYTES <= size; i += ADC_FRAME_RESULT_BYTES){
+		// Results are stored little endian
+		result = data[i] | (data[i + 1] << 8) | (data[i + 2] << 16) | ((uint32_t)data[i + 3] << 24);
+		ch = (result >> ADC_FRAME_CHANNEL_SHIFT) & ADC_FRAME_CHANNEL_MASK;
+		if((ch >= ADC_FRAME_CHANNELS) || !(frame->channel_mask & (1 << ch)) ||
+			(((result >> ADC_FRAME_UNIT_SHIFT) & ADC_FRAME_UNIT_MASK) != 0)){
+			frame->discarded++;
+			continue;
+		}
+		// A channel that got ahead of the others waits for them to keep the blocks aligned
+		if(frame->fill[ch] >= frame->length){
+			frame->discarded++;
+			continue;
+		}
+		frame->write[ch][frame->fill[ch]++] = result & ADC_FRAME_DATA_MASK;
+		if(BlockComplete(frame)){
+			SwapBlocks(frame);
+			completed++;
+		}
+	}
+	return completed;
+}
+
+uint16_t * AnalogFrameBlock(analog_frame_t *frame, adc_ch_t channel){
+	if((channel >= ADC_FRAME_CHANNELS) || !(frame->channel_mask & (1 << channel))){
+		return NULL;
+	}
+	return frame->read[channel];
+}
+
+void AnalogFrameRelease(analog_frame_t *frame){
+	frame->ready = false;
+}
+
+/*==================[end of file]============================================*/
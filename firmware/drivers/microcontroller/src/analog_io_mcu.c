@@ -11,6 +11,11 @@
 
 /*==================[inclusions]=============================================*/
 #include "analog_io_mcu.h"
+#include "analog_frame_mcu.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
 #include "driver/gptimer.h"
 #include "driver/sdm.h"
 #include "esp_adc/adc_cali_scheme.h"
@@ -19,13 +24,46 @@
 /*==================[macros and definitions]=================================*/
 #define ADC_BITWIDTH 		SOC_ADC_DIGI_MAX_BITWIDTH	// 12 bit resolution
 #define ADC_ATTENUATION		ADC_ATTEN_DB_12				// 12dB attenuation (for 0-3,3V ADC range)
+#define ADC_CONT_FRAME_SIZE	(64 * ADC_FRAME_RESULT_BYTES)	// DMA frame: 64 conversion results
+#define ADC_CONT_POOL_SIZE	(4 * ADC_CONT_FRAME_SIZE)		// Frames stored by the driver before overflow
+#define ADC_CONT_TASK_STACK	4096
+#define ADC_CONT_TASK_PRIO	10
+#define ADC_NO_BLOCK		-1							// Float block index not in use
 /*==================[internal data declaration]==============================*/
 adc_cali_handle_t adc_calibration_single_0, adc_calibration_single_1, adc_calibration_single_2, adc_calibration_single_3;
 adc_oneshot_unit_handle_t adc1_single; 
-adc_continuous_handle_t adc2_cont;
+adc_continuous_handle_t adc2_cont = NULL;
+adc_cali_handle_t adc_calibration_cont[ADC_FRAME_CHANNELS];
 sdm_channel_handle_t dac = NULL;
 bool adc1_single_used = false;
+uint8_t adc_cont_configured = 0;					/*!< Channels initialized in continuous mode (bit n = CHn) */
+uint8_t adc_cont_running = 0;						/*!< Channels being converted (bit n = CHn) */
+uint16_t adc_cont_frec = 0;							/*!< Sample frequency per channel */
+void (*adc_cont_isr_p[ADC_FRAME_CHANNELS])(void*);	/*!< Pointer to the convertion end function of each channel */
+void *adc_cont_user_data[ADC_FRAME_CHANNELS];		/*!< User data of each channel */
+static analog_frame_t adc_cont_frame;				/*!< De-interleaver for DMA frames */
+static uint8_t adc_cont_raw[ADC_CONT_FRAME_SIZE];	/*!< Last DMA frame read */
+static TaskHandle_t adc_cont_task_handle = NULL;	/*!< Task that process DMA frames */
+static SemaphoreHandle_t adc_cont_mutex = NULL;		/*!< Serializes frame processing and reconfiguration */
+static volatile uint32_t adc_cont_pool_ovf = 0;		/*!< Driver pool overflows */
+static float adc_block[ADC_FRAME_CHANNELS][2][ADC_BLOCK_SIZE];	/*!< Double buffer of calibrated blocks */
+static int8_t adc_block_owned[ADC_FRAME_CHANNELS];	/*!< Buffer owned by the user (or ADC_NO_BLOCK) */
+static int8_t adc_block_ready[ADC_FRAME_CHANNELS];	/*!< Completed buffer not yet taken (or ADC_NO_BLOCK) */
+static uint32_t adc_block_sequence;					/*!< Blocks completed since start */
+static uint32_t adc_block_ready_seq[ADC_FRAME_CHANNELS];	/*!< Sequence number of the ready buffer */
+static int64_t adc_block_ready_time[ADC_FRAME_CHANNELS];	/*!< Completion time of the ready buffer */
+static SemaphoreHandle_t adc_block_sem[ADC_FRAME_CHANNELS];	/*!< Given each time a block is ready */
+static portMUX_TYPE adc_block_mux = portMUX_INITIALIZER_UNLOCKED;
 /*==================[internal functions declaration]=========================*/
+static bool IRAM_ATTR adc_cont_conv_done_isr(adc_continuous_handle_t handle, const adc_continuous_evt_data_t *edata, void *user_data){
+	BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+	vTaskNotifyGiveFromISR(adc_cont_task_handle, &xHigherPriorityTaskWoken);
+	return (xHigherPriorityTaskWoken == pdTRUE);
+}
+static bool IRAM_ATTR adc_cont_pool_ovf_isr(adc_continuous_handle_t handle, const adc_continuous_evt_data_t *edata, void *user_data){
+	adc_cont_pool_ovf++;
+	return false;
+}
 
 /*==================[internal data definition]===============================*/
 adc_oneshot_unit_init_cfg_t init_config_single = {
@@ -39,7 +77,89 @@ adc_oneshot_chan_cfg_t adc_config_single = {
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+static void AnalogContinuousDeliver(void){
+	int voltage;
+	uint16_t *block;
+	float *block_f;
+	int8_t idx;
+	int64_t timestamp = esp_timer_get_time();
+	adc_block_sequence++;
+	for(uint8_t ch = 0; ch < ADC_FRAME_CHANNELS; ch++){
+		block = AnalogFrameBlock(&adc_cont_frame, ch);
+		if(block == NULL){
+			continue;
+		}
+		// Fill the float buffer not owned by the user. A ready block not taken yet is lost.
+		portENTER_CRITICAL(&adc_block_mux);
+		idx = (adc_block_owned[ch] != ADC_NO_BLOCK) ? (1 - adc_block_owned[ch]) :
+			  (adc_block_ready[ch] != ADC_NO_BLOCK) ? (1 - adc_block_ready[ch]) : 0;
+		adc_block_ready[ch] = ADC_NO_BLOCK;
+		portEXIT_CRITICAL(&adc_block_mux);
+		block_f = adc_block[ch][idx];
+		// Convert the block to mV only into the float buffer, the frame block keeps the raw values
+		for(uint16_t i = 0; i < adc_cont_frame.length; i++){
+			adc_cali_raw_to_voltage(adc_calibration_cont[ch], block[i], &voltage);
+			block_f[i] = voltage;
+		}
+		portENTER_CRITICAL(&adc_block_mux);
+		adc_block_ready[ch] = idx;
+		adc_block_ready_seq[ch] = adc_block_sequence;
+		adc_block_ready_time[ch] = timestamp;
+		portEXIT_CRITICAL(&adc_block_mux);
+		xSemaphoreGive(adc_block_sem[ch]);
+	}
+	for(uint8_t ch = 0; ch < ADC_FRAME_CHANNELS; ch++){
+		if((adc_cont_running & (1 << ch)) && (adc_cont_isr_p[ch] != NULL)){
+			adc_cont_isr_p[ch](adc_cont_user_data[ch]);
+		}
+	}
+	AnalogFrameRelease(&adc_cont_frame);
+}
 
+static void adc_cont_task(void *pvParameters){
+	uint32_t ret_num;
+	while(1){
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		xSemaphoreTakeRecursive(adc_cont_mutex, portMAX_DELAY);
+		while(adc_continuous_read(adc2_cont, adc_cont_raw, ADC_CONT_FRAME_SIZE, &ret_num, 0) == ESP_OK){
+			if(AnalogFrameParse(&adc_cont_frame, adc_cont_raw, ret_num) > 0){
+				AnalogContinuousDeliver();
+			}
+		}
+		xSemaphoreGiveRecursive(adc_cont_mutex);
+	}
+}
+
+static void AnalogContinuousConfig(void){
+	adc_digi_pattern_config_t pattern[ADC_FRAME_CHANNELS] = {0};
+	uint8_t n = 0;
+	for(uint8_t ch = 0; ch < ADC_FRAME_CHANNELS; ch++){
+		if(adc_cont_running & (1 << ch)){
+			pattern[n].atten = ADC_ATTENUATION;
+			pattern[n].channel = ch;
+			pattern[n].unit = ADC_UNIT_1;
+			pattern[n].bit_width = ADC_BITWIDTH;
+			n++;
+		}
+	}
+	// The ADC converts the channels one after the other
+	adc_continuous_config_t dig_cfg = {
+		.pattern_num = n,
+		.adc_pattern = pattern,
+		.sample_freq_hz = adc_cont_frec * n,
+		.conv_mode = ADC_CONV_SINGLE_UNIT_1,
+		.format = ADC_DIGI_OUTPUT_FORMAT_TYPE2,
+	};
+	ESP_ERROR_CHECK(adc_continuous_config(adc2_cont, &dig_cfg));
+	AnalogFrameInit(&adc_cont_frame, adc_cont_running, ADC_BLOCK_SIZE);
+	adc_cont_pool_ovf = 0;
+	adc_block_sequence = 0;
+	portENTER_CRITICAL(&adc_block_mux);
+	for(uint8_t ch = 0; ch < ADC_FRAME_CHANNELS; ch++){
+		adc_block_ready[ch] = ADC_NO_BLOCK;
+	}
+	portEXIT_CRITICAL(&adc_block_mux);
+}
 /*==================[external functions definition]==========================*/
 
 void AnalogInputInit(analog_input_config_t *config){
@@ -99,19 +219,39 @@ void AnalogInputInit(analog_input_config_t *config){
 			}
 		break;
 		case ADC_CONTINUOUS:
-			switch(config->input){
-				case CH0:
-
-				break;
-				case CH1:
-
-				break;
-				case CH2:
-
-				break;
-				case CH3:
-
-				break;
+			if(adc2_cont == NULL){
+				adc_continuous_handle_cfg_t handle_cfg = {
+					.max_store_buf_size = ADC_CONT_POOL_SIZE,
+					.conv_frame_size = ADC_CONT_FRAME_SIZE,
+				};
+				ESP_ERROR_CHECK(adc_continuous_new_handle(&handle_cfg, &adc2_cont));
+				adc_continuous_evt_cbs_t cont_cbs = {
+					.on_conv_done = adc_cont_conv_done_isr,
+					.on_pool_ovf = adc_cont_pool_ovf_isr,
+				};
+				ESP_ERROR_CHECK(adc_continuous_register_event_callbacks(adc2_cont, &cont_cbs, NULL));
+				// Recursive: the conversion end functions run in adc_cont_task and may start or stop channels
+				adc_cont_mutex = xSemaphoreCreateRecursiveMutex();
+				for(uint8_t ch = 0; ch < ADC_FRAME_CHANNELS; ch++){
+					adc_block_sem[ch] = xSemaphoreCreateBinary();
+					adc_block_owned[ch] = ADC_NO_BLOCK;
+					adc_block_ready[ch] = ADC_NO_BLOCK;
+				}
+				xTaskCreate(adc_cont_task, "adc_cont_task", ADC_CONT_TASK_STACK, NULL, ADC_CONT_TASK_PRIO, &adc_cont_task_handle);
+			}
+			adc_cont_isr_p[config->input] = config->func_p;
+			adc_cont_user_data[config->input] = config->param_p;
+			adc_cont_frec = config->sample_frec;
+			if(!(adc_cont_configured & (1 << config->input))){
+				// create calibration curve
+				adc_cali_curve_fitting_config_t cali_config_cont = {
+					.unit_id = ADC_UNIT_1,
+					.chan = config->input,
+					.atten = ADC_ATTENUATION,
+					.bitwidth = ADC_BITWIDTH,
+				};
+				ESP_ERROR_CHECK(adc_cali_create_scheme_curve_fitting(&cali_config_cont, &adc_calibration_cont[config->input]));
+				adc_cont_configured |= (1 << config->input);
 			}
 		break;
 	}
@@ -145,15 +285,81 @@ void AnalogInputReadSingle(adc_ch_t channel, uint16_t *value){
 }
 
 void AnalogStartContinuous(adc_ch_t channel){
-
+	if(!(adc_cont_configured & (1 << channel))){
+		return;
+	}
+	xSemaphoreTakeRecursive(adc_cont_mutex, portMAX_DELAY);
+	if(adc_cont_running){
+		adc_continuous_stop(adc2_cont);
+	}
+	adc_cont_running |= (1 << channel);
+	AnalogContinuousConfig();
+	adc_continuous_start(adc2_cont);
+	xSemaphoreGiveRecursive(adc_cont_mutex);
 }
 
 void AnalogStopContinuous(adc_ch_t channel){
-
+	if(!(adc_cont_running & (1 << channel))){
+		return;
+	}
+	xSemaphoreTakeRecursive(adc_cont_mutex, portMAX_DELAY);
+	adc_continuous_stop(adc2_cont);
+	adc_cont_running &= ~(1 << channel);
+	if(adc_cont_running){
+		AnalogContinuousConfig();
+		adc_continuous_start(adc2_cont);
+	}
+	xSemaphoreGiveRecursive(adc_cont_mutex);
 }
 
 void AnalogInputReadContinuous(adc_ch_t channel, uint16_t *values){
+	int voltage;
+	uint16_t *block = AnalogFrameBlock(&adc_cont_frame, channel);
+	if(block != NULL){
+		for(uint16_t i = 0; i < adc_cont_frame.length; i++){
+			adc_cali_raw_to_voltage(adc_calibration_cont[channel], block[i], &voltage);
+			values[i] = voltage;
+		}
+	}
+}
+
+uint32_t AnalogInputGetOverruns(void){
+	return adc_cont_frame.overruns;
+}
+
+uint32_t AnalogInputGetPoolOverflows(void){
+	return adc_cont_pool_ovf;
+}
 
+bool AnalogInputTakeBlock(adc_ch_t channel, analog_block_t *block, uint32_t timeout_ms){
+	if(!(adc_cont_configured & (1 << channel))){
+		return false;
+	}
+	AnalogInputGiveBlock(channel);
+	while(xSemaphoreTake(adc_block_sem[channel], pdMS_TO_TICKS(timeout_ms)) == pdTRUE){
+		portENTER_CRITICAL(&adc_block_mux);
+		// The ready block may have been replaced by a newer one that is still being filled
+		if(adc_block_ready[channel] != ADC_NO_BLOCK){
+			adc_block_owned[channel] = adc_block_ready[channel];
+			adc_block_ready[channel] = ADC_NO_BLOCK;
+			block->samples = adc_block[channel][adc_block_owned[channel]];
+			block->sequence = adc_block_ready_seq[channel];
+			block->timestamp = adc_block_ready_time[channel];
+			portEXIT_CRITICAL(&adc_block_mux);
+			return true;
+		}
+		portEXIT_CRITICAL(&adc_block_mux);
+	}
+	return false;
+}
+
+void AnalogInputGiveBlock(adc_ch_t channel){
+	if(!(adc_cont_configured & (1 << channel))){
+		return;
+	}
+	portENTER_CRITICAL(&adc_block_mux);
+	adc_block_owned[channel] = ADC_NO_BLOCK;
+	portEXIT_CRITICAL(&adc_block_mux);
 }
 
 void AnalogOutputWrite(uint8_t value){
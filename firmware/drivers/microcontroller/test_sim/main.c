@@ -0,0 +1,12 @@
+#include <stdio.h>
+
+int test_analog_frame();
+
+int main(void)
+{
+    printf("main starts!\n");
+    int errors = test_analog_frame();
+
+    printf("Test done\n");
+    return errors;
+}
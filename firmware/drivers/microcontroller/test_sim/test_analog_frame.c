@@ -0,0 +1,142 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "analog_frame_mcu.h"
+
+#define FRAME_RESULTS   64
+
+static analog_frame_t frame;
+static uint8_t dma_frame[FRAME_RESULTS * ADC_FRAME_RESULT_BYTES];
+static int errors = 0;
+
+#define CHECK(cond, ...) if (!(cond)) { printf("ERROR: " __VA_ARGS__); printf("\n"); errors++; }
+
+// Fake DMA source: conversion results in output format type 2
+static void put_result(int pos, uint8_t unit, uint8_t channel, uint16_t value)
+{
+    uint32_t result = (value & ADC_FRAME_DATA_MASK) |
+                      ((uint32_t)channel << ADC_FRAME_CHANNEL_SHIFT) |
+                      ((uint32_t)unit << ADC_FRAME_UNIT_SHIFT);
+    for (int b = 0; b < ADC_FRAME_RESULT_BYTES; b++) {
+        dma_frame[pos * ADC_FRAME_RESULT_BYTES + b] = (result >> (8 * b)) & 0xff;
+    }
+}
+
+// Sample n of channel ch has value ch * 1000 + n
+static uint16_t sample_value(int ch, int n)
+{
+    return (ch * 1000 + n) & ADC_FRAME_DATA_MASK;
+}
+
+// Round robin over the channels in mask, as the ADC pattern does (continuing between frames)
+static int next_ch = 0;
+static uint16_t fill_frame(uint8_t mask, int *sample, int results)
+{
+    int pos = 0;
+    while (pos < results) {
+        if (mask & (1 << next_ch)) {
+            put_result(pos++, 0, next_ch, sample_value(next_ch, sample[next_ch]++));
+        }
+        next_ch = (next_ch + 1) % ADC_FRAME_CHANNELS;
+    }
+    return pos * ADC_FRAME_RESULT_BYTES;
+}
+
+static void test_deinterleave(void)
+{
+    uint8_t mask = (1 << CH0) | (1 << CH2) | (1 << CH3);
+    int sample[ADC_FRAME_CHANNELS] = {0};
+    int blocks = 0;
+    int checked = 0;
+    next_ch = 0;
+    AnalogFrameInit(&frame, mask, ADC_BLOCK_SIZE);
+    // 10 blocks of 3 channels, delivered in 64 results frames
+    while (blocks < 10) {
+        uint16_t size = fill_frame(mask, sample, FRAME_RESULTS);
+        if (AnalogFrameParse(&frame, dma_frame, size) > 0) {
+            for (int ch = 0; ch < ADC_FRAME_CHANNELS; ch++) {
+                uint16_t *block = AnalogFrameBlock(&frame, ch);
+                if (!(mask & (1 << ch))) {
+                    CHECK(block == NULL, "disabled channel %i returned a block", ch);
+                    continue;
+                }
+                for (int n = 0; n < ADC_BLOCK_SIZE; n++) {
+                    uint16_t expected = sample_value(ch, blocks * ADC_BLOCK_SIZE + n);
+                    CHECK(block[n] == expected, "block %i ch %i sample %i: %i, expected %i", blocks, ch, n, block[n], expected);
+                    checked++;
+                }
+            }
+            AnalogFrameRelease(&frame);
+            blocks++;
+        }
+    }
+    CHECK(frame.overruns == 0, "unexpected overruns: %i", (int)frame.overruns);
+    CHECK(frame.discarded == 0, "unexpected discarded results: %i", (int)frame.discarded);
+    printf("De-interleave: %i samples checked\n", checked);
+}
+
+static void test_overrun(void)
+{
+    uint8_t mask = (1 << CH1);
+    int sample[ADC_FRAME_CHANNELS] = {0};
+    next_ch = 0;
+    AnalogFrameInit(&frame, mask, ADC_BLOCK_SIZE);
+    // Three blocks without releasing: the first two are lost
+    int completed = 0;
+    for (int i = 0; i < 3 * ADC_BLOCK_SIZE / FRAME_RESULTS; i++) {
+        uint16_t size = fill_frame(mask, sample, FRAME_RESULTS);
+        completed += AnalogFrameParse(&frame, dma_frame, size);
+    }
+    CHECK(completed == 3, "completed blocks: %i, expected 3", completed);
+    CHECK(frame.overruns == 2, "overruns: %i, expected 2", (int)frame.overruns);
+    // The readable block is the newest one
+    uint16_t *block = AnalogFrameBlock(&frame, CH1);
+    CHECK(block[0] == sample_value(CH1, 2 * ADC_BLOCK_SIZE), "newest block not delivered");
+    AnalogFrameRelease(&frame);
+    for (int i = 0; i < ADC_BLOCK_SIZE / FRAME_RESULTS; i++) {
+        uint16_t size = fill_frame(mask, sample, FRAME_RESULTS);
+        AnalogFrameParse(&frame, dma_frame, size);
+    }
+    CHECK(frame.overruns == 2, "overrun counted after release");
+    printf("Overrun: %i blocks lost\n", (int)frame.overruns);
+}
+
+static void test_discard(void)
+{
+    uint8_t mask = (1 << CH0) | (1 << CH1);
+    AnalogFrameInit(&frame, mask, 4);
+    // Results of other unit, disabled channel and a channel ahead of the others
+    put_result(0, 1, CH0, 1);
+    put_result(1, 0, CH3, 2);
+    put_result(2, 0, CH0, 10);
+    put_result(3, 0, CH0, 11);
+    put_result(4, 0, CH0, 12);
+    put_result(5, 0, CH0, 13);
+    put_result(6, 0, CH0, 14);
+    put_result(7, 0, CH1, 20);
+    put_result(8, 0, CH1, 21);
+    put_result(9, 0, CH1, 22);
+    put_result(10, 0, CH1, 23);
+    uint16_t completed = AnalogFrameParse(&frame, dma_frame, 11 * ADC_FRAME_RESULT_BYTES);
+    CHECK(completed == 1, "completed blocks: %i, expected 1", completed);
+    CHECK(frame.discarded == 3, "discarded: %i, expected 3", (int)frame.discarded);
+    uint16_t *block = AnalogFrameBlock(&frame, CH0);
+    CHECK(block[0] == 10 && block[3] == 13, "channel 0 block out of order");
+    block = AnalogFrameBlock(&frame, CH1);
+    CHECK(block[0] == 20 && block[3] == 23, "channel 1 block out of order");
+    // Partial results (less than one conversion) are ignored
+    completed = AnalogFrameParse(&frame, dma_frame, ADC_FRAME_RESULT_BYTES - 1);
+    CHECK(completed == 0, "partial result parsed");
+}
+
+int test_analog_frame()
+{
+    test_deinterleave();
+    test_overrun();
+    test_discard();
+    if (errors == 0) {
+        printf("Test Correct!\n");
+    }
+    return errors;
+}
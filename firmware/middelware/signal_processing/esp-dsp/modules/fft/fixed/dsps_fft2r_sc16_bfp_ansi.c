@@ -0,0 +1,99 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dsps_fft2r.h"
+#include "dsp_common.h"
+#include "dsp_types.h"
+#include <stdlib.h>
+
+// Shift of a stage for the max of |re| + |im| at its input, so the outputs
+// (|a +- w*b| <= 2 * max) fit in 16 bits
+static inline int bfp_stage_shift(int max)
+{
+    if (max > INT16_MAX) {
+        return 2;
+    }
+    if (max > (INT16_MAX >> 1)) {
+        return 1;
+    }
+    return 0;
+}
+
+esp_err_t dsps_fft2r_sc16_bfp_ansi_(int16_t *data, int N, int16_t *sc_table, int *exponent)
+{
+    if (!dsp_is_power_of_two(N)) {
+        return ESP_ERR_DSP_INVALID_LENGTH;
+    }
+    if (!dsps_fft2r_sc16_initialized) {
+        return ESP_ERR_DSP_UNINITIALIZED;
+    }
+
+    sc16_t *w = (sc16_t *)sc_table;
+    sc16_t *in_data = (sc16_t *)data;
+
+    int max = 0;
+    for (int i = 0; i < N; i++) {
+        int l1 = abs(in_data[i].re) + abs(in_data[i].im);
+        if (l1 > max) {
+            max = l1;
+        }
+    }
+    *exponent = 0;
+
+    int ie = 1;
+    for (int N2 = N / 2; N2 > 0; N2 >>= 1) {
+        // The input of each stage is scaled only when its outputs could overflow.
+        // The max of the next stage is taken while the outputs are stored.
+        int shift = bfp_stage_shift(max);
+        // Products are kept in Q15 until the final shift. For shift = 2 one bit is
+        // dropped before the addition to stay inside 32 bits.
+        int pre = shift >> 1;
+        int out_shift = 15 + shift - pre;
+        int rnd = 1 << (out_shift - 1);
+        *exponent += shift;
+        max = 0;
+        int ia = 0;
+        for (int j = 0; j < ie; j++) {
+            sc16_t cs = w[j]; // c - re, s - im
+            for (int i = 0; i < N2; i++) {
+                int m = ia + N2;
+                sc16_t m_data = in_data[m];
+                sc16_t a_data = in_data[ia];
+                int32_t re_temp = ((int32_t)cs.re * m_data.re + (int32_t)cs.im * m_data.im) >> pre;
+                int32_t im_temp = ((int32_t)cs.re * m_data.im - (int32_t)cs.im * m_data.re) >> pre;
+                int32_t a_re = (int32_t)a_data.re << (15 - pre);
+                int32_t a_im = (int32_t)a_data.im << (15 - pre);
+
+                sc16_t m1, m2;
+                m1.re = (a_re - re_temp + rnd) >> out_shift;
+                m1.im = (a_im - im_temp + rnd) >> out_shift;
+                m2.re = (a_re + re_temp + rnd) >> out_shift;
+                m2.im = (a_im + im_temp + rnd) >> out_shift;
+                in_data[m] = m1;
+                in_data[ia] = m2;
+
+                int l1 = abs(m1.re) + abs(m1.im);
+                if (l1 > max) {
+                    max = l1;
+                }
+                l1 = abs(m2.re) + abs(m2.im);
+                if (l1 > max) {
+                    max = l1;
+                }
+                ia++;
+            }
+            ia += N2;
+        }
+        ie <<= 1;
+    }
+    return ESP_OK;
+}
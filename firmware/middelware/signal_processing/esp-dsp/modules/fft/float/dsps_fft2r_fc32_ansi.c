@@ -120,17 +120,8 @@ void dsps_fft2r_deinit_fc32()
     dsps_fft2r_initialized = 0;
 }
 
-esp_err_t dsps_fft2r_fc32_ansi_(float *data, int N, float *w)
+static inline void dsps_fft2r_fc32_ansi_butterflies(float *data, int N, const float *w)
 {
-    if (!dsp_is_power_of_two(N)) {
-        return ESP_ERR_DSP_INVALID_LENGTH;
-    }
-    if (!dsps_fft2r_initialized) {
-        return ESP_ERR_DSP_UNINITIALIZED;
-    }
-
-    esp_err_t result = ESP_OK;
-
     int ie, ia, m;
     float re_temp, im_temp;
     float c, s;
@@ -154,7 +145,35 @@ esp_err_t dsps_fft2r_fc32_ansi_(float *data, int N, float *w)
         }
         ie <<= 1;
     }
-    return result;
+}
+
+esp_err_t dsps_fft2r_fc32_ansi_(float *data, int N, float *w)
+{
+    if (!dsp_is_power_of_two(N)) {
+        return ESP_ERR_DSP_INVALID_LENGTH;
+    }
+    if (!dsps_fft2r_initialized) {
+        return ESP_ERR_DSP_UNINITIALIZED;
+    }
+    dsps_fft2r_fc32_ansi_butterflies(data, N, w);
+    return ESP_OK;
+}
+
+esp_err_t dsps_fft2r_plan_fc32_ansi(const dsps_fft2r_plan_fc32_t *plan, float *data)
+{
+    if ((plan == NULL) || (plan->w == NULL)) {
+        return ESP_ERR_DSP_UNINITIALIZED;
+    }
+    dsps_fft2r_fc32_ansi_butterflies(data, plan->N, plan->w);
+    return ESP_OK;
+}
+
+esp_err_t dsps_bit_rev_plan_fc32_ansi(const dsps_fft2r_plan_fc32_t *plan, float *data)
+{
+    if ((plan == NULL) || (plan->rev_table == NULL)) {
+        return ESP_ERR_DSP_UNINITIALIZED;
+    }
+    return dsps_bit_rev_lookup_fc32_ansi(data, plan->rev_size, plan->rev_table);
 }
 
 
@@ -169,14 +188,8 @@ unsigned short reverse(unsigned short x, unsigned short N, int order)
     return b >> (16 - order);
 }
 
-esp_err_t dsps_bit_rev_fc32_ansi(float *data, int N)
+static void dsps_bit_rev_fc32_ansi_loop(float *data, int N)
 {
-    if (!dsp_is_power_of_two(N)) {
-        return ESP_ERR_DSP_INVALID_LENGTH;
-    }
-
-    esp_err_t result = ESP_OK;
-
     int j, k;
     float r_temp, i_temp;
     j = 0;
@@ -196,7 +209,20 @@ esp_err_t dsps_bit_rev_fc32_ansi(float *data, int N)
             data[i * 2 + 1] = i_temp;
         }
     }
-    return result;
+}
+
+esp_err_t dsps_bit_rev_fc32_ansi(float *data, int N)
+{
+    if (!dsp_is_power_of_two(N)) {
+        return ESP_ERR_DSP_INVALID_LENGTH;
+    }
+    int pow = dsp_power_of_two(N);
+    if ((pow >= 4) && (pow <= 12)) {
+        return dsps_bit_rev_lookup_fc32_ansi(data, dsps_fft2r_rev_tables_fc32_size[pow - 4], dsps_fft2r_rev_tables_fc32[pow - 4]);
+    }
+    // No precalculated table for this size (plans have their own table for any size)
+    dsps_bit_rev_fc32_ansi_loop(data, N);
+    return ESP_OK;
 }
 
 esp_err_t dsps_gen_w_r2_fc32(float *w, int N)
@@ -0,0 +1,122 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dsps_fft2r.h"
+#include "dsp_common.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Tables of one FFT size, shared by all the plans of that size
+typedef struct {
+    float *w;
+    uint16_t *rev_table;
+    int rev_size;
+    int refs;       // Not atomic, init/deinit must be called from a single task
+} dsps_fft2r_plan_tables_t;
+
+// Indexed by log2(N), N up to 2^13 (the swap table stores byte offsets in 16 bits)
+#define DSPS_FFT2R_PLAN_MAX_POW 13
+
+static dsps_fft2r_plan_tables_t dsps_fft2r_plan_tables[DSPS_FFT2R_PLAN_MAX_POW + 1];
+
+esp_err_t dsps_gen_bitrev2r_fc32(uint16_t *table, int N, int *table_size)
+{
+    if (!dsp_is_power_of_two(N) || (N > (1 << DSPS_FFT2R_PLAN_MAX_POW))) {
+        return ESP_ERR_DSP_INVALID_LENGTH;
+    }
+    // Same walk as dsps_bit_rev_fc32_ansi, each pair stored as byte offsets of the complex elements
+    int j = 0;
+    int k;
+    int count = 0;
+    for (int i = 1; i < (N - 1); i++) {
+        k = N >> 1;
+        while (k <= j) {
+            j -= k;
+            k >>= 1;
+        }
+        j += k;
+        if (i < j) {
+            if (table != NULL) {
+                table[count * 2 + 0] = i * 2 * sizeof(float);
+                table[count * 2 + 1] = j * 2 * sizeof(float);
+            }
+            count++;
+        }
+    }
+    *table_size = count;
+    return ESP_OK;
+}
+
+esp_err_t dsps_fft2r_plan_init_fc32(dsps_fft2r_plan_fc32_t *plan, int N)
+{
+    if (!dsp_is_power_of_two(N) || (N < 2)) {
+        return ESP_ERR_DSP_INVALID_LENGTH;
+    }
+    if (N > CONFIG_DSP_MAX_FFT_SIZE) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    int pow = dsp_power_of_two(N);
+    if (pow > DSPS_FFT2R_PLAN_MAX_POW) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    dsps_fft2r_plan_tables_t *tables = &dsps_fft2r_plan_tables[pow];
+
+    if (tables->refs == 0) {
+        esp_err_t result = dsps_gen_bitrev2r_fc32(NULL, N, &tables->rev_size);
+        if (result != ESP_OK) {
+            return result;
+        }
+        tables->w = (float *)malloc(N * sizeof(float));
+        // At least one element, so a 2 points plan also gets a valid pointer
+        tables->rev_table = (uint16_t *)malloc((2 * tables->rev_size + 1) * sizeof(uint16_t));
+        if ((tables->w == NULL) || (tables->rev_table == NULL)) {
+            free(tables->w);
+            free(tables->rev_table);
+            memset(tables, 0, sizeof(dsps_fft2r_plan_tables_t));
+            return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+        }
+        dsps_gen_bitrev2r_fc32(tables->rev_table, N, &tables->rev_size);
+        // Same table dsps_fft2r_init_fc32 generates, but only as long as this size needs
+        result = dsps_gen_w_r2_fc32(tables->w, N);
+        if (result == ESP_OK) {
+            result = dsps_bit_rev_fc32_ansi(tables->w, N >> 1);
+        }
+        if (result != ESP_OK) {
+            free(tables->w);
+            free(tables->rev_table);
+            memset(tables, 0, sizeof(dsps_fft2r_plan_tables_t));
+            return result;
+        }
+    }
+    tables->refs++;
+
+    plan->N = N;
+    plan->w = tables->w;
+    plan->rev_table = tables->rev_table;
+    plan->rev_size = tables->rev_size;
+    return ESP_OK;
+}
+
+void dsps_fft2r_plan_deinit_fc32(dsps_fft2r_plan_fc32_t *plan)
+{
+    if (plan->w == NULL) {
+        return;
+    }
+    dsps_fft2r_plan_tables_t *tables = &dsps_fft2r_plan_tables[dsp_power_of_two(plan->N)];
+    tables->refs--;
+    if (tables->refs == 0) {
+        free(tables->w);
+        free(tables->rev_table);
+        memset(tables, 0, sizeof(dsps_fft2r_plan_tables_t));
+    }
+    memset(plan, 0, sizeof(dsps_fft2r_plan_fc32_t));
+}
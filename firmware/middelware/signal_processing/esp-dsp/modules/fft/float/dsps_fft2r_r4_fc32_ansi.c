@@ -0,0 +1,132 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dsps_fft2r.h"
+#include "dsp_common.h"
+#include "dsp_types.h"
+
+// Two radix 2 stages of dsps_fft2r_fc32_ansi_ merged in one pass (radix 2^2).
+// In the bit reversed table w[2j + 1] = w[2j] rotated by pi/2 and w[j] = w[2j]^2, so with
+// V = conj(w[2j]) the four outputs of a group only need V*x1, V^2*x2 and V^3*x3.
+// The result is the same as dsps_fft2r_fc32_ansi_ (also in bit reversed order).
+static void dsps_fft2r_r4_fc32_ansi_core(float *data, int N, const float *w)
+{
+    fc32_t *x = (fc32_t *)data;
+    int len = N;
+    int groups = 1;
+
+    if (dsp_power_of_two(N) & 1) {
+        // Odd number of stages: first one alone, its only twiddle is 1
+        int half = N >> 1;
+        for (int i = 0; i < half; i++) {
+            fc32_t a = x[i];
+            fc32_t b = x[i + half];
+            x[i].re = a.re + b.re;
+            x[i].im = a.im + b.im;
+            x[i + half].re = a.re - b.re;
+            x[i + half].im = a.im - b.im;
+        }
+        len = half;
+        groups = 2;
+    }
+
+    while (len >= 4) {
+        int q = len >> 2;
+        // Group 0: V = 1, no multiplications
+        for (int i = 0; i < q; i++) {
+            fc32_t *p = &x[i];
+            fc32_t x0 = p[0];
+            fc32_t x1 = p[q];
+            fc32_t x2 = p[2 * q];
+            fc32_t x3 = p[3 * q];
+            float y0_re = x0.re + x2.re;
+            float y0_im = x0.im + x2.im;
+            float y2_re = x0.re - x2.re;
+            float y2_im = x0.im - x2.im;
+            float e_re = x1.re + x3.re;
+            float e_im = x1.im + x3.im;
+            float f_re = x1.re - x3.re;
+            float f_im = x1.im - x3.im;
+            p[0].re = y0_re + e_re;
+            p[0].im = y0_im + e_im;
+            p[q].re = y0_re - e_re;
+            p[q].im = y0_im - e_im;
+            p[2 * q].re = y2_re + f_im;
+            p[2 * q].im = y2_im - f_re;
+            p[3 * q].re = y2_re - f_im;
+            p[3 * q].im = y2_im + f_re;
+        }
+        for (int g = 1; g < groups; g++) {
+            // Twiddles are loaded once per group: V from w[2g], V^2 from w[g], V^3 = V * V^2
+            float c1 = w[2 * (2 * g)];
+            float s1 = w[2 * (2 * g) + 1];
+            float c2 = w[2 * g];
+            float s2 = w[2 * g + 1];
+            float c3 = c1 * c2 - s1 * s2;
+            float s3 = c1 * s2 + s1 * c2;
+            fc32_t *p = &x[g * len];
+            for (int i = 0; i < q; i++) {
+                fc32_t x0 = p[0];
+                fc32_t x1 = p[q];
+                fc32_t x2 = p[2 * q];
+                fc32_t x3 = p[3 * q];
+                // Multiplication by conj(c + j*s), as in dsps_fft2r_fc32_ansi_
+                float a_re = c2 * x2.re + s2 * x2.im;
+                float a_im = c2 * x2.im - s2 * x2.re;
+                float b_re = c1 * x1.re + s1 * x1.im;
+                float b_im = c1 * x1.im - s1 * x1.re;
+                float d_re = c3 * x3.re + s3 * x3.im;
+                float d_im = c3 * x3.im - s3 * x3.re;
+                float y0_re = x0.re + a_re;
+                float y0_im = x0.im + a_im;
+                float y2_re = x0.re - a_re;
+                float y2_im = x0.im - a_im;
+                float e_re = b_re + d_re;
+                float e_im = b_im + d_im;
+                float f_re = b_re - d_re;
+                float f_im = b_im - d_im;
+                p[0].re = y0_re + e_re;
+                p[0].im = y0_im + e_im;
+                p[q].re = y0_re - e_re;
+                p[q].im = y0_im - e_im;
+                p[2 * q].re = y2_re + f_im;
+                p[2 * q].im = y2_im - f_re;
+                p[3 * q].re = y2_re - f_im;
+                p[3 * q].im = y2_im + f_re;
+                p++;
+            }
+        }
+        len = q;
+        groups <<= 2;
+    }
+}
+
+esp_err_t dsps_fft2r_r4_fc32_ansi_(float *data, int N, float *w)
+{
+    if (!dsp_is_power_of_two(N)) {
+        return ESP_ERR_DSP_INVALID_LENGTH;
+    }
+    if (!dsps_fft2r_initialized) {
+        return ESP_ERR_DSP_UNINITIALIZED;
+    }
+    dsps_fft2r_r4_fc32_ansi_core(data, N, w);
+    return ESP_OK;
+}
+
+esp_err_t dsps_fft2r_r4_plan_fc32_ansi(const dsps_fft2r_plan_fc32_t *plan, float *data)
+{
+    if ((plan == NULL) || (plan->w == NULL)) {
+        return ESP_ERR_DSP_UNINITIALIZED;
+    }
+    dsps_fft2r_r4_fc32_ansi_core(data, plan->N, plan->w);
+    return ESP_OK;
+}
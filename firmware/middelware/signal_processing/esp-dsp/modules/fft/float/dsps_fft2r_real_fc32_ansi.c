@@ -0,0 +1,90 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dsps_fft2r.h"
+#include "dsp_common.h"
+
+esp_err_t dsps_cplx2real2r_fc32_ansi(float *data, int N, const float *table, int table_size)
+{
+    if (!dsp_is_power_of_two(N) || (N < 2)) {
+        return ESP_ERR_DSP_INVALID_LENGTH;
+    }
+    if ((table == NULL) || (table_size < 2 * N)) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    int step = table_size / (2 * N);
+
+    // Bin 0 and Nyquist bin are real
+    float re = data[0];
+    float im = data[1];
+    data[0] = re + im;
+    data[1] = re - im;
+
+    // Bins k and N - k are calculated together from Z[k] and Z[N - k]:
+    // X[k] = E + W^k * O, X[N - k] = conj(E - W^k * O)
+    for (int k = 1; k <= N / 2; k++) {
+        float *zk = &data[2 * k];
+        float *zn = &data[2 * (N - k)];
+        float e_re = 0.5f * (zk[0] + zn[0]);
+        float e_im = 0.5f * (zk[1] - zn[1]);
+        float o_re = 0.5f * (zk[1] + zn[1]);
+        float o_im = -0.5f * (zk[0] - zn[0]);
+        float c = table[2 * k * step + 0];
+        float s = table[2 * k * step + 1];
+        // W^k = c - j*s
+        float t_re = c * o_re + s * o_im;
+        float t_im = c * o_im - s * o_re;
+        zk[0] = e_re + t_re;
+        zk[1] = e_im + t_im;
+        zn[0] = e_re - t_re;
+        zn[1] = t_im - e_im;
+    }
+    return ESP_OK;
+}
+
+esp_err_t dsps_real2cplx2r_fc32_ansi(float *data, int N, const float *table, int table_size)
+{
+    if (!dsp_is_power_of_two(N) || (N < 2)) {
+        return ESP_ERR_DSP_INVALID_LENGTH;
+    }
+    if ((table == NULL) || (table_size < 2 * N)) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    int step = table_size / (2 * N);
+
+    // Z[0] = E + j*O, from bin 0 and Nyquist bin
+    float x0 = data[0];
+    float xn = data[1];
+    data[0] = 0.5f * (x0 + xn);
+    data[1] = 0.5f * (x0 - xn);
+
+    // Inverse of dsps_cplx2real2r_fc32_ansi: E = (X[k] + conj(X[N - k])) / 2,
+    // O = W^-k * (X[k] - conj(X[N - k])) / 2, Z[k] = E + j*O, Z[N - k] = conj(E) + j*conj(O)
+    for (int k = 1; k <= N / 2; k++) {
+        float *xk = &data[2 * k];
+        float *xnk = &data[2 * (N - k)];
+        float e_re = 0.5f * (xk[0] + xnk[0]);
+        float e_im = 0.5f * (xk[1] - xnk[1]);
+        float t_re = 0.5f * (xk[0] - xnk[0]);
+        float t_im = 0.5f * (xk[1] + xnk[1]);
+        float c = table[2 * k * step + 0];
+        float s = table[2 * k * step + 1];
+        // W^-k = c + j*s
+        float o_re = c * t_re - s * t_im;
+        float o_im = c * t_im + s * t_re;
+        xk[0] = e_re - o_im;
+        xk[1] = e_im + o_re;
+        xnk[0] = e_re + o_im;
+        xnk[1] = o_re - e_im;
+    }
+    return ESP_OK;
+}
@@ -37,6 +37,20 @@ extern int16_t *dsps_fft_w_table_sc16;
 extern int dsps_fft_w_table_sc16_size;
 extern uint8_t dsps_fft2r_sc16_initialized;
 
+/**
+ * @brief FFT radix 2 plan
+ *
+ * Tables needed for a complex FFT of one size. Unlike dsps_fft2r_init_fc32, plans of
+ * different sizes can be used at the same time. All the plans of the same size share
+ * one copy of the tables (counted, freed when the last plan is deinitialized).
+ */
+typedef struct dsps_fft2r_plan_fc32_s {
+    int N;                  /*!< Number of complex elements */
+    float *w;               /*!< sin/cos table (N floats) */
+    uint16_t *rev_table;    /*!< Bit reverse swap pairs, as used by dsps_bit_rev_lookup_fc32 */
+    int rev_size;           /*!< Number of swap pairs */
+} dsps_fft2r_plan_fc32_t;
+
 
 /**@{*/
 /**
@@ -107,12 +121,106 @@ esp_err_t dsps_fft2r_sc16_aes3_(int16_t *data, int N, int16_t *w);
 #define dsps_fft2r_fc32_ansi(data, N) dsps_fft2r_fc32_ansi_(data, N, dsps_fft_w_table_fc32)
 #define dsps_fft2r_sc16_ansi(data, N) dsps_fft2r_sc16_ansi_(data, N, dsps_fft_w_table_sc16)
 
+/**@{*/
+/**
+ * @brief      complex FFT of radix 2 computed with radix 4 butterflies
+ *
+ * Same result (and bit reversed output order) as dsps_fft2r_fc32, with the same sin/cos table,
+ * but every two radix 2 stages are calculated in one pass over the data (radix 2^2).
+ * It needs 3 complex multiplications for every 4 points instead of 4, half the loads and
+ * stores, and the first group of each pass has no multiplications.
+ * For the targets without an optimized radix 2 implementation (i.e. ESP32-C6).
+ * The implementation use ANSI C and could be compiled and run on any platform
+ *
+ * @param[inout] data: input/output complex array. An elements located: Re[0], Im[0], ... Re[N-1], Im[N-1]
+ *               result of FFT will be stored to this array.
+ * @param[in] N: Number of complex elements in input array
+ * @param[in] w: pointer to the sin/cos table
+ * @param[in] plan: initialized plan (size and sin/cos table)
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dsps_fft2r_r4_fc32_ansi_(float *data, int N, float *w);
+esp_err_t dsps_fft2r_r4_plan_fc32_ansi(const dsps_fft2r_plan_fc32_t *plan, float *data);
+/**@}*/
+#define dsps_fft2r_r4_fc32_ansi(data, N) dsps_fft2r_r4_fc32_ansi_(data, N, dsps_fft_w_table_fc32)
+
+/**@{*/
+/**
+ * @brief      init and deinit FFT radix 2 plan
+ *
+ * Generates (or shares with the plans of the same size) the sin/cos and bit reverse
+ * tables for a complex FFT of N points. Global state used by dsps_fft2r_init_fc32
+ * is not modified.
+ * The shared tables are reference counted without any lock: init and deinit are not
+ * thread safe and must be called from a single task (or with a mutex held by the caller).
+ * Initialized plans can be executed concurrently from any task.
+ * The implementation use ANSI C and could be compiled and run on any platform
+ *
+ * @param[out] plan: plan to initialize
+ * @param[in] N: Number of complex elements (power of two, up to CONFIG_DSP_MAX_FFT_SIZE and 8192)
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_DSP_PARAM_OUTOFRANGE if N > CONFIG_DSP_MAX_FFT_SIZE, N > 8192 or not enough memory
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dsps_fft2r_plan_init_fc32(dsps_fft2r_plan_fc32_t *plan, int N);
+void dsps_fft2r_plan_deinit_fc32(dsps_fft2r_plan_fc32_t *plan);
+/**@}*/
+
+/**@{*/
+/**
+ * @brief      complex FFT of radix 2 and bit reverse with a plan
+ *
+ * Same as dsps_fft2r_fc32 and dsps_bit_rev_fc32, with the size and tables of the plan.
+ * The implementation use ANSI C and could be compiled and run on any platform
+ *
+ * @param[in] plan: initialized plan
+ * @param[inout] data: input/output complex array of plan->N elements. An elements located: Re[0], Im[0], ... Re[N-1], Im[N-1]
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_DSP_UNINITIALIZED if the plan is not initialized
+ */
+esp_err_t dsps_fft2r_plan_fc32_ansi(const dsps_fft2r_plan_fc32_t *plan, float *data);
+esp_err_t dsps_bit_rev_plan_fc32_ansi(const dsps_fft2r_plan_fc32_t *plan, float *data);
+/**@}*/
+
+/**@{*/
+/**
+ * @brief      complex FFT of radix 2 with block floating point scaling
+ *
+ * Complex FFT of radix 2 for 16 bit data. Unlike dsps_fft2r_sc16, that divides the data by 2
+ * in every stage, each stage is only scaled (by 2 or 4) when its outputs could overflow.
+ * The number of bits the data was shifted right is returned, so the FFT result is
+ * data * 2^exponent. Small signals keep all their resolution.
+ * The implementation use ANSI C and could be compiled and run on any platform
+ *
+ * @param[inout] data: input/output complex array. An elements located: Re[0], Im[0], ... Re[N-1], Im[N-1]
+ *               result of FFT will be stored to this array.
+ * @param[in] N: Number of complex elements in input array
+ * @param[in] w: pointer to the sin/cos table
+ * @param[out] exponent: total right shift applied to the data
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dsps_fft2r_sc16_bfp_ansi_(int16_t *data, int N, int16_t *w, int *exponent);
+/**@}*/
+#define dsps_fft2r_sc16_bfp_ansi(data, N, exponent) dsps_fft2r_sc16_bfp_ansi_(data, N, dsps_fft_w_table_sc16, exponent)
+
 
 /**@{*/
 /**
  * @brief      bit reverse operation for the complex input array
  *
  * Bit reverse operation for the complex input array
+ * dsps_bit_rev_fc32_ansi swaps the elements with the precalculated tables in dsps_fft_tables.h,
+ * other sizes are reversed without a table. It never allocates memory.
  * The implementation use ANSI C and could be compiled and run on any platform
  *
  * @param[inout] data: input/ complex array. An elements located: Re[0], Im[0], ... Re[N-1], Im[N-1]
@@ -196,8 +304,75 @@ esp_err_t dsps_cplx2real_sc16_ansi(int16_t *data, int N);
 /**@}*/
 esp_err_t dsps_cplx2real256_fc32_ansi(float *data);
 
+/**@{*/
+/**
+ * @brief      Convert half length complex FFT result to the spectrum of a real signal
+ *
+ * A real signal of 2*N samples can be transformed with a complex FFT of N points, taking
+ * the even samples as real part and the odd samples as imaginary part. This function
+ * separates the result (after bit reverse) into the first N bins of the real signal spectrum.
+ * The Nyquist bin (real) is stored in place of the imaginary part of bin 0 (which is always zero).
+ * The implementation use ANSI C and could be compiled and run on any platform
+ *
+ * @param[inout] data: Input complex array and result of FFT2R of N points.
+ *               input has size of 2*N, because contains real and imaginary part.
+ *               result will be stored to the same array: Re[0], Re[N], Re[1], Im[1], ... Re[N-1], Im[N-1]
+ * @param[in] N: Number of complex elements in input array
+ * @param[in] table: sin/cos table (cos and sin of 2*pi*i/table_size for i = 0..table_size/4),
+ *               as generated by dsps_gen_w_r2_fc32(table, table_size)
+ * @param[in] table_size: length of the biggest real signal the table can be used for (>= 2*N)
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dsps_cplx2real2r_fc32_ansi(float *data, int N, const float *table, int table_size);
+/**@}*/
+
+/**@{*/
+/**
+ * @brief      Convert the spectrum of a real signal to the input of a half length complex FFT
+ *
+ * Inverse of dsps_cplx2real2r_fc32. From the first N bins of the spectrum of a real signal
+ * of 2*N samples (with the Nyquist bin in place of the imaginary part of bin 0), calculates
+ * the N points spectrum whose inverse complex FFT is the signal (even samples as real part and
+ * odd samples as imaginary part).
+ * The implementation use ANSI C and could be compiled and run on any platform
+ *
+ * @param[inout] data: Re[0], Re[N], Re[1], Im[1], ... Re[N-1], Im[N-1] of the real signal spectrum,
+ *               result will be stored to the same array.
+ * @param[in] N: Number of complex elements in input array
+ * @param[in] table: sin/cos table, as for dsps_cplx2real2r_fc32
+ * @param[in] table_size: length of the biggest real signal the table can be used for (>= 2*N)
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dsps_real2cplx2r_fc32_ansi(float *data, int N, const float *table, int table_size);
+/**@}*/
+
 esp_err_t dsps_gen_bitrev2r_table(int N, int step, char *name_ext);
 
+/**@{*/
+/**
+ * @brief      Generate bit reverse swap table
+ *
+ * Generates the swap pairs for the bit reverse of N complex floats, in the format of
+ * the precalculated tables in dsps_fft_tables.h (byte offsets of both elements).
+ * The implementation use ANSI C and could be compiled and run on any platform
+ *
+ * @param[out] table: memory location to store 2 * table_size values, NULL to only count them
+ * @param[in] N: Number of complex elements (power of two, up to 8192)
+ * @param[out] table_size: number of swap pairs
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dsps_gen_bitrev2r_fc32(uint16_t *table, int N, int *table_size);
+/**@}*/
+
 #ifdef __cplusplus
 }
 #endif
@@ -205,6 +380,13 @@ esp_err_t dsps_gen_bitrev2r_table(int N, int step, char *name_ext);
 #if CONFIG_DSP_OPTIMIZED
 #define dsps_bit_rev_fc32 dsps_bit_rev_fc32_ansi
 #define dsps_cplx2reC_fc32 dsps_cplx2reC_fc32_ansi
+#define dsps_cplx2real2r_fc32 dsps_cplx2real2r_fc32_ansi
+#define dsps_real2cplx2r_fc32 dsps_real2cplx2r_fc32_ansi
+#define dsps_fft2r_sc16_bfp dsps_fft2r_sc16_bfp_ansi
+#define dsps_fft2r_plan_fc32 dsps_fft2r_plan_fc32_ansi
+#define dsps_bit_rev_plan_fc32 dsps_bit_rev_plan_fc32_ansi
+#define dsps_fft2r_r4_fc32 dsps_fft2r_r4_fc32_ansi
+#define dsps_fft2r_r4_plan_fc32 dsps_fft2r_r4_plan_fc32_ansi
 
 #if (dsps_fft2r_fc32_aes3_enabled == 1)
 #define dsps_fft2r_fc32 dsps_fft2r_fc32_aes3
@@ -237,6 +419,13 @@ esp_err_t dsps_gen_bitrev2r_table(int N, int step, char *name_ext);
 #define dsps_fft2r_fc32 dsps_fft2r_fc32_ansi
 #define dsps_bit_rev_fc32 dsps_bit_rev_fc32_ansi
 #define dsps_cplx2reC_fc32 dsps_cplx2reC_fc32_ansi
+#define dsps_cplx2real2r_fc32 dsps_cplx2real2r_fc32_ansi
+#define dsps_real2cplx2r_fc32 dsps_real2cplx2r_fc32_ansi
+#define dsps_fft2r_sc16_bfp dsps_fft2r_sc16_bfp_ansi
+#define dsps_fft2r_plan_fc32 dsps_fft2r_plan_fc32_ansi
+#define dsps_bit_rev_plan_fc32 dsps_bit_rev_plan_fc32_ansi
+#define dsps_fft2r_r4_fc32 dsps_fft2r_r4_fc32_ansi
+#define dsps_fft2r_r4_plan_fc32 dsps_fft2r_r4_plan_fc32_ansi
 #define dsps_bit_rev_sc16 dsps_bit_rev_sc16_ansi
 #define dsps_bit_rev_lookup_fc32 dsps_bit_rev_lookup_fc32_ansi
 
@@ -0,0 +1,91 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string.h>
+#include "unity.h"
+#include "dsp_platform.h"
+#include "esp_log.h"
+
+#include "dsp_common.h"
+#include "dsps_fft2r.h"
+#include "dsp_tests.h"
+
+static const char *TAG = "dsps_bit_rev_fc32_ansi";
+
+#define MAX_N 8192
+
+static float data[2 * MAX_N];
+static float check_data[2 * MAX_N];
+
+// Reverse index calculated for every element (previous implementation)
+static void bit_rev_reference(float *data, int N)
+{
+    int j = 0;
+    int k;
+    float temp;
+    for (int i = 1; i < (N - 1); i++) {
+        k = N >> 1;
+        while (k <= j) {
+            j -= k;
+            k >>= 1;
+        }
+        j += k;
+        if (i < j) {
+            temp = data[j * 2];
+            data[j * 2] = data[i * 2];
+            data[i * 2] = temp;
+            temp = data[j * 2 + 1];
+            data[j * 2 + 1] = data[i * 2 + 1];
+            data[i * 2 + 1] = temp;
+        }
+    }
+}
+
+TEST_CASE("dsps_bit_rev_fc32_ansi functionality", "[dsps]")
+{
+    for (int N = 2 ; N <= MAX_N ; N *= 2) {
+        for (int i = 0 ; i < 2 * N ; i++) {
+            data[i] = i;
+            check_data[i] = i;
+        }
+        // Twice, the swap must not depend on previous calls
+        for (int n = 0 ; n < 2 ; n++) {
+            TEST_ESP_OK(dsps_bit_rev_fc32_ansi(data, N));
+            bit_rev_reference(check_data, N);
+            for (int i = 0 ; i < 2 * N ; i++) {
+                if (data[i] != check_data[i]) {
+                    ESP_LOGE(TAG, "N = %i, data[%i] = %f, expected = %f", N, i, data[i], check_data[i]);
+                    TEST_ASSERT_EQUAL(check_data[i], data[i]);
+                }
+            }
+        }
+    }
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_INVALID_LENGTH, dsps_bit_rev_fc32_ansi(data, 100));
+}
+
+TEST_CASE("dsps_bit_rev_fc32_ansi benchmark", "[dsps]")
+{
+    for (int N = 64 ; N <= 4096 ; N *= 2) {
+        unsigned int start_b = dsp_get_cpu_cycle_count();
+        bit_rev_reference(check_data, N);
+        unsigned int end_b = dsp_get_cpu_cycle_count();
+        int cycles_loop = end_b - start_b;
+
+        start_b = dsp_get_cpu_cycle_count();
+        dsps_bit_rev_fc32_ansi(data, N);
+        end_b = dsp_get_cpu_cycle_count();
+        int cycles_table = end_b - start_b;
+
+        ESP_LOGI(TAG, "N = %4i: index loop - %6i cycles, swap table - %6i cycles", N, cycles_loop, cycles_table);
+        TEST_ASSERT_EXEC_IN_RANGE(1, cycles_loop, cycles_table);
+    }
+}
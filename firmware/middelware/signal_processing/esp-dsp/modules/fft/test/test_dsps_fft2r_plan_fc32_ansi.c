@@ -0,0 +1,132 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string.h>
+#include "unity.h"
+#include "dsp_platform.h"
+#include "esp_log.h"
+
+#include "dsp_common.h"
+#include "dsps_fft2r.h"
+#include "dsp_tests.h"
+
+static const char *TAG = "dsps_fft2r_plan_fc32_ansi";
+
+#define MAX_N 2048
+
+static float x[2 * MAX_N];
+static float data[2 * MAX_N];
+static float check_data[2 * MAX_N];
+
+static void random_input(int N)
+{
+    for (int i = 0 ; i < 2 * N ; i++) {
+        x[i] = (float)rand() / RAND_MAX - 0.5;
+    }
+}
+
+// FFT with the global tables
+static void fft_reference(int N)
+{
+    memcpy(check_data, x, 2 * N * sizeof(float));
+    dsps_fft2r_fc32_ansi(check_data, N);
+    dsps_bit_rev_fc32_ansi(check_data, N);
+}
+
+static void fft_plan(dsps_fft2r_plan_fc32_t *plan)
+{
+    memcpy(data, x, 2 * plan->N * sizeof(float));
+    TEST_ESP_OK(dsps_fft2r_plan_fc32_ansi(plan, data));
+    TEST_ESP_OK(dsps_bit_rev_plan_fc32_ansi(plan, data));
+}
+
+static void check_result(int N)
+{
+    for (int i = 0 ; i < 2 * N ; i++) {
+        if (fabsf(data[i] - check_data[i]) > 1e-4) {
+            ESP_LOGE(TAG, "N = %i, data[%i] = %f, expected = %f", N, i, data[i], check_data[i]);
+            TEST_ASSERT_FLOAT_WITHIN(1e-4, check_data[i], data[i]);
+        }
+    }
+}
+
+TEST_CASE("dsps_fft2r_plan_fc32_ansi functionality", "[dsps]")
+{
+    dsps_fft2r_plan_fc32_t plan_256;
+    dsps_fft2r_plan_fc32_t plan_2048;
+    dsps_fft2r_plan_fc32_t plan_2048_b;
+
+    TEST_ESP_OK(dsps_fft2r_init_fc32(NULL, MAX_N));
+    TEST_ESP_OK(dsps_fft2r_plan_init_fc32(&plan_256, 256));
+    TEST_ESP_OK(dsps_fft2r_plan_init_fc32(&plan_2048, 2048));
+    TEST_ESP_OK(dsps_fft2r_plan_init_fc32(&plan_2048_b, 2048));
+    // Plans of the same size share their tables
+    TEST_ASSERT_EQUAL_PTR(plan_2048.w, plan_2048_b.w);
+    TEST_ASSERT_EQUAL_PTR(plan_2048.rev_table, plan_2048_b.rev_table);
+    TEST_ASSERT_EQUAL(dsps_fft2r_rev_tables_fc32_size[4], plan_256.rev_size);
+    TEST_ASSERT_EQUAL(dsps_fft2r_rev_tables_fc32_size[7], plan_2048.rev_size);
+
+    // Both sizes interleaved, without any re-init
+    for (int n = 0 ; n < 3 ; n++) {
+        random_input(256);
+        fft_reference(256);
+        fft_plan(&plan_256);
+        check_result(256);
+        random_input(2048);
+        fft_reference(2048);
+        fft_plan(&plan_2048);
+        check_result(2048);
+    }
+    // Other plans and global tables can be freed
+    dsps_fft2r_plan_deinit_fc32(&plan_2048);
+    dsps_fft2r_deinit_fc32();
+    TEST_ASSERT_NULL(plan_2048.w);
+    TEST_ESP_OK(dsps_fft2r_init_fc32(NULL, MAX_N));
+    random_input(2048);
+    fft_reference(2048);
+    fft_plan(&plan_2048_b);
+    check_result(2048);
+
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_INVALID_LENGTH, dsps_fft2r_plan_init_fc32(&plan_2048, 100));
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_PARAM_OUTOFRANGE, dsps_fft2r_plan_init_fc32(&plan_2048, 2 * CONFIG_DSP_MAX_FFT_SIZE));
+    // Beyond the 16 bits byte offsets of the swap table, whatever CONFIG_DSP_MAX_FFT_SIZE is
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_PARAM_OUTOFRANGE, dsps_fft2r_plan_init_fc32(&plan_2048, 1 << 14));
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_UNINITIALIZED, dsps_fft2r_plan_fc32_ansi(&plan_2048, data));
+    dsps_fft2r_plan_deinit_fc32(&plan_256);
+    dsps_fft2r_plan_deinit_fc32(&plan_2048_b);
+    dsps_fft2r_deinit_fc32();
+}
+
+TEST_CASE("dsps_fft2r_plan_fc32_ansi benchmark", "[dsps]")
+{
+    dsps_fft2r_plan_fc32_t plan;
+    TEST_ESP_OK(dsps_fft2r_init_fc32(NULL, MAX_N));
+    random_input(MAX_N);
+
+    for (int N = 64 ; N <= MAX_N ; N *= 4) {
+        unsigned int start_b = dsp_get_cpu_cycle_count();
+        fft_reference(N);
+        unsigned int end_b = dsp_get_cpu_cycle_count();
+        int cycles_global = end_b - start_b;
+
+        TEST_ESP_OK(dsps_fft2r_plan_init_fc32(&plan, N));
+        start_b = dsp_get_cpu_cycle_count();
+        fft_plan(&plan);
+        end_b = dsp_get_cpu_cycle_count();
+        int cycles_plan = end_b - start_b;
+        dsps_fft2r_plan_deinit_fc32(&plan);
+
+        ESP_LOGI(TAG, "N = %i: global tables - %i cycles, plan - %i cycles", N, cycles_global, cycles_plan);
+        TEST_ASSERT_EXEC_IN_RANGE(1, 2 * cycles_global, cycles_plan);
+    }
+    dsps_fft2r_deinit_fc32();
+}
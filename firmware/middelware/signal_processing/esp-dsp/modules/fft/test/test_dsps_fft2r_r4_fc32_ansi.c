@@ -0,0 +1,154 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string.h>
+#include "unity.h"
+#include "dsp_platform.h"
+#include "esp_log.h"
+
+#include "dsp_common.h"
+#include "dsps_tone_gen.h"
+#include "dsps_fft2r.h"
+#include "dsp_tests.h"
+
+static const char *TAG = "dsps_fft2r_r4_fc32_ansi";
+
+#define MAX_N 4096
+
+static float x[2 * MAX_N];
+static float data[2 * MAX_N];
+static float check_data[2 * MAX_N];
+#define DFT_MAX_N 256
+static float dft[2 * DFT_MAX_N];
+
+// Direct DFT in double precision, in bit reversed order as the FFT output
+static void dft_reference(int N)
+{
+    for (int k = 0 ; k < N ; k++) {
+        double re = 0;
+        double im = 0;
+        for (int n = 0 ; n < N ; n++) {
+            double a = -2 * M_PI * (double)((k * n) % N) / N;
+            re += x[2 * n] * cos(a) - x[2 * n + 1] * sin(a);
+            im += x[2 * n] * sin(a) + x[2 * n + 1] * cos(a);
+        }
+        dft[2 * k] = re;
+        dft[2 * k + 1] = im;
+    }
+    dsps_bit_rev_fc32_ansi(dft, N);
+}
+
+// Relative RMS error of a against b
+static float rms_error(const float *a, const float *b, int N)
+{
+    double err = 0;
+    double pow = 0;
+    for (int i = 0 ; i < 2 * N ; i++) {
+        err += ((double)a[i] - b[i]) * ((double)a[i] - b[i]);
+        pow += (double)b[i] * b[i];
+    }
+    return sqrt(err / pow);
+}
+
+static void check_size(int N, bool tone)
+{
+    if (tone) {
+        dsps_tone_gen_f32(x, 2 * N, 1, 0.0123, 0);
+    } else {
+        for (int i = 0 ; i < 2 * N ; i++) {
+            x[i] = (float)rand() / RAND_MAX - 0.5;
+        }
+    }
+    memcpy(check_data, x, 2 * N * sizeof(float));
+    memcpy(data, x, 2 * N * sizeof(float));
+    TEST_ESP_OK(dsps_fft2r_fc32_ansi(check_data, N));
+    TEST_ESP_OK(dsps_fft2r_r4_fc32_ansi(data, N));
+    // Same output order, so it is compared before the bit reverse
+    float err = rms_error(data, check_data, N);
+    if (err > 1e-6) {
+        ESP_LOGE(TAG, "N = %i: relative error against radix 2 = %e", N, err);
+    }
+    TEST_ASSERT_TRUE(err <= 1e-6f);
+    // Not less accurate than radix 2
+    if (N <= DFT_MAX_N) {
+        dft_reference(N);
+        float err_r2 = rms_error(check_data, dft, N);
+        float err_r4 = rms_error(data, dft, N);
+        ESP_LOGD(TAG, "N = %i: relative error against DFT, radix 2 = %e, radix 4 = %e", N, err_r2, err_r4);
+        TEST_ASSERT_TRUE(err_r4 <= 1.5f * err_r2 + 1e-7f);
+    }
+}
+
+TEST_CASE("dsps_fft2r_r4_fc32_ansi functionality", "[dsps]")
+{
+    TEST_ESP_OK(dsps_fft2r_init_fc32(NULL, MAX_N));
+    // Even and odd number of radix 2 stages
+    for (int N = 2 ; N <= MAX_N ; N *= 2) {
+        check_size(N, false);
+        check_size(N, true);
+    }
+    // Tone in a bin, all the energy must be there
+    int N = 1024;
+    for (int i = 0 ; i < N ; i++) {
+        data[2 * i + 0] = sinf(2 * M_PI * 32 * i / N);
+        data[2 * i + 1] = 0;
+    }
+    dsps_fft2r_r4_fc32_ansi(data, N);
+    dsps_bit_rev_fc32_ansi(data, N);
+    TEST_ASSERT_FLOAT_WITHIN(1e-2, N / 2, data[2 * 32 + 1] * -1);
+    TEST_ASSERT_FLOAT_WITHIN(1e-2, N / 2, data[2 * (N - 32) + 1]);
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_INVALID_LENGTH, dsps_fft2r_r4_fc32_ansi(data, 100));
+    dsps_fft2r_deinit_fc32();
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_UNINITIALIZED, dsps_fft2r_r4_fc32_ansi_(data, N, check_data));
+}
+
+TEST_CASE("dsps_fft2r_r4_fc32_ansi plan", "[dsps]")
+{
+    dsps_fft2r_plan_fc32_t plan;
+    TEST_ESP_OK(dsps_fft2r_init_fc32(NULL, MAX_N));
+    for (int N = 64 ; N <= 2048 ; N *= 2) {
+        TEST_ESP_OK(dsps_fft2r_plan_init_fc32(&plan, N));
+        for (int i = 0 ; i < 2 * N ; i++) {
+            x[i] = (float)rand() / RAND_MAX - 0.5;
+        }
+        memcpy(check_data, x, 2 * N * sizeof(float));
+        memcpy(data, x, 2 * N * sizeof(float));
+        dsps_fft2r_fc32_ansi(check_data, N);
+        TEST_ESP_OK(dsps_fft2r_r4_plan_fc32_ansi(&plan, data));
+        TEST_ASSERT_TRUE(rms_error(data, check_data, N) <= 1e-6f);
+        dsps_fft2r_plan_deinit_fc32(&plan);
+    }
+    dsps_fft2r_deinit_fc32();
+}
+
+TEST_CASE("dsps_fft2r_r4_fc32_ansi benchmark", "[dsps]")
+{
+    TEST_ESP_OK(dsps_fft2r_init_fc32(NULL, MAX_N));
+    for (int N = 64 ; N <= MAX_N ; N *= 2) {
+        for (int i = 0 ; i < 2 * N ; i++) {
+            data[i] = (float)rand() / RAND_MAX - 0.5;
+        }
+        unsigned int start_b = dsp_get_cpu_cycle_count();
+        dsps_fft2r_fc32_ansi(data, N);
+        unsigned int end_b = dsp_get_cpu_cycle_count();
+        int cycles_r2 = end_b - start_b;
+
+        start_b = dsp_get_cpu_cycle_count();
+        dsps_fft2r_r4_fc32_ansi(data, N);
+        end_b = dsp_get_cpu_cycle_count();
+        int cycles_r4 = end_b - start_b;
+
+        ESP_LOGI(TAG, "N = %4i: radix 2 - %7i cycles, radix 4 - %7i cycles", N, cycles_r2, cycles_r4);
+        TEST_ASSERT_EXEC_IN_RANGE(1, cycles_r2, cycles_r4);
+    }
+    dsps_fft2r_deinit_fc32();
+}
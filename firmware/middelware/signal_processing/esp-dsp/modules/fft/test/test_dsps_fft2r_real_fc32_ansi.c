@@ -0,0 +1,137 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string.h>
+#include "unity.h"
+#include "dsp_platform.h"
+#include "esp_log.h"
+
+#include "dsp_common.h"
+#include "dsps_tone_gen.h"
+#include "dsps_fft2r.h"
+#include "dsp_tests.h"
+
+static const char *TAG = "dsps_cplx2real2r_fc32_ansi";
+
+#define MAX_N 2048
+
+static float x[MAX_N];
+static float data[MAX_N];
+static float check_data[2 * MAX_N];
+static float table[MAX_N];
+
+// Spectrum of x with the N points complex FFT (imaginary part = 0)
+static void fft_reference(int N)
+{
+    for (int i = 0 ; i < N ; i++) {
+        check_data[i * 2 + 0] = x[i];
+        check_data[i * 2 + 1] = 0;
+    }
+    dsps_fft2r_fc32_ansi(check_data, N);
+    dsps_bit_rev_fc32_ansi(check_data, N);
+}
+
+// Spectrum of x with the N/2 points complex FFT
+static void fft_real(int N)
+{
+    memcpy(data, x, N * sizeof(float));
+    dsps_fft2r_fc32_ansi(data, N / 2);
+    dsps_bit_rev_fc32_ansi(data, N / 2);
+    TEST_ESP_OK(dsps_cplx2real2r_fc32_ansi(data, N / 2, table, MAX_N));
+}
+
+static void check_spectrum(int N)
+{
+    float max = 0;
+    for (int i = 0 ; i < N ; i++) {
+        max = fmaxf(max, fabsf(check_data[i]));
+    }
+    float tol = max * 1e-5;
+    TEST_ASSERT_FLOAT_WITHIN(tol, check_data[0], data[0]);
+    TEST_ASSERT_FLOAT_WITHIN(tol, check_data[N], data[1]);
+    for (int i = 2 ; i < N ; i++) {
+        if (fabsf(data[i] - check_data[i]) > tol) {
+            ESP_LOGE(TAG, "N = %i, data[%i] = %f, expected = %f", N, i, data[i], check_data[i]);
+            TEST_ASSERT_FLOAT_WITHIN(tol, check_data[i], data[i]);
+        }
+    }
+}
+
+TEST_CASE("dsps_cplx2real2r_fc32_ansi functionality", "[dsps]")
+{
+    TEST_ESP_OK(dsps_fft2r_init_fc32(NULL, MAX_N));
+    TEST_ESP_OK(dsps_gen_w_r2_fc32(table, MAX_N));
+
+    for (int N = 8 ; N <= MAX_N ; N *= 2) {
+        // Random input
+        for (int i = 0 ; i < N ; i++) {
+            x[i] = (float)rand() / RAND_MAX - 0.5;
+        }
+        fft_reference(N);
+        fft_real(N);
+        check_spectrum(N);
+        // Tone (not in a bin center) with DC offset
+        dsps_tone_gen_f32(x, N, 1, 0.123, 30);
+        for (int i = 0 ; i < N ; i++) {
+            x[i] += 0.25;
+        }
+        fft_reference(N);
+        fft_real(N);
+        check_spectrum(N);
+    }
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_INVALID_LENGTH, dsps_cplx2real2r_fc32_ansi(data, 100, table, MAX_N));
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_PARAM_OUTOFRANGE, dsps_cplx2real2r_fc32_ansi(data, MAX_N, table, MAX_N));
+    dsps_fft2r_deinit_fc32();
+}
+
+TEST_CASE("dsps_cplx2real2r_fc32_ansi benchmark", "[dsps]")
+{
+    TEST_ESP_OK(dsps_fft2r_init_fc32(NULL, MAX_N));
+    TEST_ESP_OK(dsps_gen_w_r2_fc32(table, MAX_N));
+    dsps_tone_gen_f32(x, MAX_N, 1, 0.1, 0);
+
+    for (int N = 64 ; N <= MAX_N ; N *= 4) {
+        unsigned int start_b = dsp_get_cpu_cycle_count();
+        fft_reference(N);
+        unsigned int end_b = dsp_get_cpu_cycle_count();
+        int cycles_complex = end_b - start_b;
+
+        start_b = dsp_get_cpu_cycle_count();
+        fft_real(N);
+        end_b = dsp_get_cpu_cycle_count();
+        int cycles_real = end_b - start_b;
+
+        ESP_LOGI(TAG, "N = %i: complex FFT - %i cycles, half length FFT + dsps_cplx2real2r_fc32_ansi - %i cycles", N, cycles_complex, cycles_real);
+        TEST_ASSERT_EXEC_IN_RANGE(1, cycles_complex, cycles_real);
+    }
+    dsps_fft2r_deinit_fc32();
+}
+
+TEST_CASE("dsps_real2cplx2r_fc32_ansi functionality", "[dsps]")
+{
+    TEST_ESP_OK(dsps_gen_w_r2_fc32(table, MAX_N));
+    for (int N = 4 ; N <= MAX_N ; N *= 2) {
+        for (int i = 0 ; i < N ; i++) {
+            x[i] = (float)rand() / RAND_MAX - 0.5;
+        }
+        // Z from the even and odd samples, and back to Z from the real spectrum
+        memcpy(check_data, x, N * sizeof(float));
+        memcpy(data, x, N * sizeof(float));
+        TEST_ESP_OK(dsps_cplx2real2r_fc32_ansi(data, N / 2, table, MAX_N));
+        TEST_ESP_OK(dsps_real2cplx2r_fc32_ansi(data, N / 2, table, MAX_N));
+        for (int i = 0 ; i < N ; i++) {
+            TEST_ASSERT_FLOAT_WITHIN(1e-5, check_data[i], data[i]);
+        }
+    }
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_INVALID_LENGTH, dsps_real2cplx2r_fc32_ansi(data, 100, table, MAX_N));
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_PARAM_OUTOFRANGE, dsps_real2cplx2r_fc32_ansi(data, MAX_N, table, MAX_N));
+}
@@ -0,0 +1,107 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string.h>
+#include "unity.h"
+#include "dsp_platform.h"
+#include "esp_log.h"
+
+#include "dsp_common.h"
+#include "dsps_fft2r.h"
+#include "dsp_tests.h"
+
+static const char *TAG = "dsps_fft2r_sc16_bfp_ansi";
+
+#define MAX_N 1024
+
+static int16_t data[MAX_N * 2];
+static int16_t data_sc16[MAX_N * 2];
+static float data_fc32[MAX_N * 2];
+
+// Signal to noise ratio (dB) of a 16 bit FFT result scaled by 2^exponent, against the float FFT
+static float fft_snr(int16_t *result, int exponent, int N)
+{
+    double signal = 0;
+    double noise = 0;
+    for (int i = 0 ; i < N * 2 ; i++) {
+        double err = ldexp(result[i], exponent) - data_fc32[i];
+        signal += (double)data_fc32[i] * data_fc32[i];
+        noise += err * err;
+    }
+    return 10 * log10(signal / (noise + 1e-30));
+}
+
+TEST_CASE("dsps_fft2r_sc16_bfp_ansi functionality", "[dsps]")
+{
+    TEST_ESP_OK(dsps_fft2r_init_sc16(NULL, MAX_N));
+    TEST_ESP_OK(dsps_fft2r_init_fc32(NULL, MAX_N));
+    // Full scale tone, 12 bit noise and a full scale square wave (worst case for overflow)
+    int amplitudes[3] = {INT16_MAX, 2047, INT16_MAX};
+    for (int test = 0 ; test < 3 ; test++) {
+        int N = MAX_N;
+        for (int i = 0 ; i < N ; i++) {
+            if (test == 0) {
+                data[i * 2 + 0] = amplitudes[test] * sinf(2 * M_PI * 0.1234 * i);
+                data[i * 2 + 1] = amplitudes[test] * cosf(2 * M_PI * 0.0567 * i);
+            } else if (test == 1) {
+                data[i * 2 + 0] = amplitudes[test] * ((float)rand() / RAND_MAX - 0.5);
+                data[i * 2 + 1] = amplitudes[test] * ((float)rand() / RAND_MAX - 0.5);
+            } else {
+                data[i * 2 + 0] = (i & 0x10) ? amplitudes[test] : -amplitudes[test];
+                data[i * 2 + 1] = (i & 0x20) ? amplitudes[test] : -amplitudes[test];
+            }
+        }
+        for (int i = 0 ; i < N * 2 ; i++) {
+            data_fc32[i] = data[i];
+        }
+        memcpy(data_sc16, data, sizeof(data));
+        dsps_fft2r_fc32_ansi(data_fc32, N);
+
+        int exponent;
+        TEST_ESP_OK(dsps_fft2r_sc16_bfp_ansi(data, N, &exponent));
+        dsps_fft2r_sc16_ansi(data_sc16, N);
+
+        float snr_bfp = fft_snr(data, exponent, N);
+        float snr_sc16 = fft_snr(data_sc16, dsp_power_of_two(N), N);
+        ESP_LOGI(TAG, "Test %i: exponent %i, SNR dsps_fft2r_sc16_bfp_ansi = %f dB, dsps_fft2r_sc16_ansi = %f dB", test, exponent, snr_bfp, snr_sc16);
+        TEST_ASSERT_LESS_OR_EQUAL(dsp_power_of_two(N), exponent);
+        TEST_ASSERT_TRUE(snr_bfp > 60);
+        TEST_ASSERT_TRUE(snr_bfp >= snr_sc16);
+    }
+    dsps_fft2r_deinit_sc16();
+    dsps_fft2r_deinit_fc32();
+}
+
+TEST_CASE("dsps_fft2r_sc16_bfp_ansi benchmark", "[dsps]")
+{
+    TEST_ESP_OK(dsps_fft2r_init_sc16(NULL, MAX_N));
+    for (int N = 64 ; N <= MAX_N ; N *= 4) {
+        int exponent;
+        for (int i = 0 ; i < N * 2 ; i++) {
+            data[i] = 2047 * ((float)rand() / RAND_MAX - 0.5);
+        }
+        memcpy(data_sc16, data, sizeof(data));
+        unsigned int start_b = dsp_get_cpu_cycle_count();
+        dsps_fft2r_sc16_ansi(data_sc16, N);
+        unsigned int end_b = dsp_get_cpu_cycle_count();
+        int cycles_sc16 = end_b - start_b;
+
+        start_b = dsp_get_cpu_cycle_count();
+        dsps_fft2r_sc16_bfp_ansi(data, N, &exponent);
+        end_b = dsp_get_cpu_cycle_count();
+        int cycles_bfp = end_b - start_b;
+
+        ESP_LOGI(TAG, "N = %i: dsps_fft2r_sc16_ansi - %i cycles, dsps_fft2r_sc16_bfp_ansi - %i cycles", N, cycles_sc16, cycles_bfp);
+        TEST_ASSERT_EXEC_IN_RANGE(1, 4 * cycles_sc16, cycles_bfp);
+    }
+    dsps_fft2r_deinit_sc16();
+}
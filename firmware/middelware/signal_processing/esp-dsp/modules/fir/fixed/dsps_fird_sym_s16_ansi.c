@@ -0,0 +1,82 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dsps_fir.h"
+
+int32_t dsps_fird_sym_s16_ansi(fir_s16_t *fir, const int16_t *input, int16_t *output, int32_t len)
+{
+    int32_t result = 0;
+    int32_t input_pos = 0;
+    long long rounding = 0;
+    const int32_t final_shift = fir->shift - 15;
+    const int16_t half = fir->coeffs_len >> 1;
+
+    rounding = (long long)(fir->rounding_val);
+
+    if (fir->shift >= 0) {
+        rounding = (rounding >> fir->shift) & 0xFFFFFFFFFF;         // 40-bit mask
+    } else {
+        rounding = (rounding << (-fir->shift)) & 0xFFFFFFFFFF;      // 40-bit mask
+    }
+
+    for (int i = 0; i < len; i++) {
+
+        for (int j = 0; j < fir->decim - fir->d_pos; j++) {
+
+            if (fir->pos >= fir->coeffs_len) {
+                fir->pos = 0;
+            }
+            fir->delay[fir->pos++] = input[input_pos++];
+        }
+        fir->d_pos = 0;
+
+        long long acc = rounding;
+        // Oldest sample at a, newest at b: coeffs[k] multiplies both delay[a + k] and delay[b - k].
+        // The pre-added pair needs 17 bits, so the product is calculated in 64 bits.
+        int32_t a = (fir->pos >= fir->coeffs_len) ? 0 : fir->pos;
+        int32_t b = fir->pos - 1;
+        int32_t k = 0;
+        while (k < half) {
+            // Run up to the first wrap of either index
+            int32_t run = half - k;
+            if (run > fir->coeffs_len - a) {
+                run = fir->coeffs_len - a;
+            }
+            if (run > b + 1) {
+                run = b + 1;
+            }
+            for (int n = 0; n < run; n++) {
+                acc += (long long)fir->coeffs[k + n] * ((int32_t)fir->delay[a + n] + (int32_t)fir->delay[b - n]);
+            }
+            k += run;
+            a += run;
+            if (a >= fir->coeffs_len) {
+                a = 0;
+            }
+            b -= run;
+            if (b < 0) {
+                b = fir->coeffs_len - 1;
+            }
+        }
+        if (fir->coeffs_len & 1) {
+            acc += (int32_t)fir->coeffs[half] * (int32_t)fir->delay[a];
+        }
+
+        if (final_shift > 0) {
+            output[result++] = (int16_t)(acc << final_shift);
+        } else {
+            output[result++] = (int16_t)(acc >> (-final_shift));
+        }
+
+    }
+    return result;
+}
@@ -0,0 +1,30 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dsps_fir.h"
+#include "dsps_dotprod.h"
+
+esp_err_t dsps_fir_mirror_f32_ansi(fir_f32_t *fir, const float *input, float *output, int len)
+{
+    for (int i = 0 ; i < len ; i++) {
+        // Each sample is stored twice, N positions apart, so the last N samples are
+        // always contiguous from the oldest one at delay[pos]
+        fir->delay[fir->pos] = input[i];
+        fir->delay[fir->pos + fir->N] = input[i];
+        fir->pos++;
+        if (fir->pos >= fir->N) {
+            fir->pos = 0;
+        }
+        dsps_dotprod_f32(fir->coeffs, &fir->delay[fir->pos], &output[i], fir->N);
+    }
+    return ESP_OK;
+}
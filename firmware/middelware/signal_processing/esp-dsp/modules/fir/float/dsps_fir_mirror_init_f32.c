@@ -0,0 +1,40 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <stdlib.h>
+#include "dsps_fir.h"
+
+esp_err_t dsps_fir_mirror_init_f32(fir_f32_t *fir, float *coeffs, float *delay, int coeffs_len)
+{
+    if (coeffs_len <= 0) {
+        return ESP_ERR_DSP_INVALID_LENGTH;
+    }
+    // Allocate delay line in case if it's NULL
+    if (delay == NULL) {
+        delay = (float *)malloc(2 * coeffs_len * sizeof(float));
+        if (delay == NULL) {
+            return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+        }
+        fir->use_delay = 1;
+    } else {
+        fir->use_delay = 0;
+    }
+    for (int i = 0; i < 2 * coeffs_len; i++) {
+        delay[i] = 0;
+    }
+    fir->coeffs = coeffs;
+    fir->delay = delay;
+    fir->N = coeffs_len;
+    fir->pos = 0;
+    fir->decim = 1;
+    return ESP_OK;
+}
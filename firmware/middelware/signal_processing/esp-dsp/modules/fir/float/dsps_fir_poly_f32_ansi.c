@@ -0,0 +1,68 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dsps_fir.h"
+
+// Push one input sample and calculate the outputs whose newest input it is
+static inline int dsps_fir_poly_f32_sample(fir_poly_f32_t *fir, float input, float *output)
+{
+    int result = 0;
+    fir->delay[fir->pos++] = input;
+    if (fir->pos >= fir->taps) {
+        fir->pos = 0;
+    }
+    while (fir->phase < fir->interp) {
+        const float *coeffs = &fir->coeffs[fir->phase * fir->taps];
+        float acc = 0;
+        int coeff_pos = 0;
+        for (int n = fir->pos; n < fir->taps ; n++) {
+            acc += coeffs[coeff_pos++] * fir->delay[n];
+        }
+        for (int n = 0; n < fir->pos ; n++) {
+            acc += coeffs[coeff_pos++] * fir->delay[n];
+        }
+        output[result++] = acc;
+        fir->phase += fir->decim;
+    }
+    fir->phase -= fir->interp;
+    return result;
+}
+
+int dsps_fir_poly_f32_ansi(fir_poly_f32_t *fir, const float *input, float *output, int len)
+{
+    int result = 0;
+    int i = 0;
+    if (fir->interp == 1) {
+        // Pure decimation: up to the start of a group of decim inputs, then all the
+        // complete groups with dsps_fird_f32_ansi, that uses the same delay line
+        for (; (i < len) && (fir->phase != fir->decim - 1); i++) {
+            result += dsps_fir_poly_f32_sample(fir, input[i], &output[result]);
+        }
+        int groups = (len - i) / fir->decim;
+        if (groups > 0) {
+            fir_f32_t fird = {
+                .coeffs = fir->coeffs,
+                .delay = fir->delay,
+                .N = fir->taps,
+                .pos = fir->pos,
+                .decim = fir->decim,
+            };
+            result += dsps_fird_f32_ansi(&fird, &input[i], &output[result], groups);
+            fir->pos = fird.pos;
+            i += groups * fir->decim;
+        }
+    }
+    for (; i < len; i++) {
+        result += dsps_fir_poly_f32_sample(fir, input[i], &output[result]);
+    }
+    return result;
+}
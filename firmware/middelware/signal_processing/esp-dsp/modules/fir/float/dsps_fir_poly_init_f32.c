@@ -0,0 +1,72 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <stdlib.h>
+#include "dsps_fir.h"
+
+esp_err_t dsps_fir_poly_init_f32(fir_poly_f32_t *fir, const float *coeffs, float *delay, int coeffs_len, int interp, int decim)
+{
+    if ((coeffs_len <= 0) || (interp <= 0) || (decim <= 0)) {
+        return ESP_ERR_DSP_INVALID_PARAM;
+    }
+    int taps = (coeffs_len + interp - 1) / interp;
+    float *poly = (float *)calloc(interp * taps, sizeof(float));
+    if (poly == NULL) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    // coeffs[coeffs_len - 1] is applied to the newest sample. Sub-filter p holds the taps
+    // p, p + interp, p + 2 * interp... counted from the newest sample, stored oldest first
+    // as in dsps_fir_f32 (with interp = 1 it is the same array).
+    for (int p = 0; p < interp; p++) {
+        for (int k = 0; k < taps; k++) {
+            int tap = p + k * interp;
+            if (tap < coeffs_len) {
+                poly[p * taps + taps - 1 - k] = coeffs[coeffs_len - 1 - tap];
+            }
+        }
+    }
+    // Allocate delay line in case if it's NULL
+    if (delay == NULL) {
+        delay = (float *)malloc(taps * sizeof(float));
+        if (delay == NULL) {
+            free(poly);
+            return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+        }
+        fir->use_delay = 1;
+    } else {
+        fir->use_delay = 0;
+    }
+    for (int i = 0 ; i < taps; i++) {
+        delay[i] = 0;
+    }
+    fir->coeffs = poly;
+    fir->delay = delay;
+    fir->N = coeffs_len;
+    fir->taps = taps;
+    fir->pos = 0;
+    fir->interp = interp;
+    fir->decim = decim;
+    // First output after decim inputs, as dsps_fird_f32
+    fir->phase = decim - 1;
+    return ESP_OK;
+}
+
+esp_err_t dsps_fir_poly_f32_free(fir_poly_f32_t *fir)
+{
+    free(fir->coeffs);
+    fir->coeffs = NULL;
+    if (fir->use_delay != 0) {
+        fir->use_delay = 0;
+        free(fir->delay);
+    }
+    return ESP_OK;
+}
@@ -0,0 +1,57 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dsps_fir.h"
+
+esp_err_t dsps_fir_sym_f32_ansi(fir_f32_t *fir, const float *input, float *output, int len)
+{
+    int half = fir->N >> 1;
+    for (int i = 0 ; i < len ; i++) {
+        float acc = 0;
+        fir->delay[fir->pos] = input[i];
+        fir->pos++;
+        if (fir->pos >= fir->N) {
+            fir->pos = 0;
+        }
+        // Oldest sample at a, newest at b: coeffs[k] multiplies both delay[a + k] and delay[b - k]
+        int a = fir->pos;
+        int b = (fir->pos == 0) ? (fir->N - 1) : (fir->pos - 1);
+        int k = 0;
+        while (k < half) {
+            // Run up to the first wrap of either index
+            int run = half - k;
+            if (run > fir->N - a) {
+                run = fir->N - a;
+            }
+            if (run > b + 1) {
+                run = b + 1;
+            }
+            for (int n = 0; n < run; n++) {
+                acc += fir->coeffs[k + n] * (fir->delay[a + n] + fir->delay[b - n]);
+            }
+            k += run;
+            a += run;
+            if (a >= fir->N) {
+                a = 0;
+            }
+            b -= run;
+            if (b < 0) {
+                b = fir->N - 1;
+            }
+        }
+        if (fir->N & 1) {
+            acc += fir->coeffs[half] * fir->delay[a];
+        }
+        output[i] = acc;
+    }
+    return ESP_OK;
+}
@@ -62,6 +62,25 @@ typedef struct fir_s16_s {
     int16_t     free_status;    /*!< Indicator for dsps_fird_s16_aes3_free() function*/
 } fir_s16_t;
 
+/**
+ * @brief Data struct of f32 polyphase resampling fir filter
+ *
+ * This structure is used by a filter internally. A user should access this structure only in case of
+ * extensions for the DSP Library.
+ * All fields of this structure are initialized by the dsps_fir_poly_init_f32(...) function.
+ */
+typedef struct fir_poly_f32_s {
+    float  *coeffs;     /*!< Polyphase coefficients, interp sub-filters of taps coefficients each.*/
+    float  *delay;      /*!< Pointer to the delay line buffer.*/
+    int     N;          /*!< FIR filter coefficients amount.*/
+    int     taps;       /*!< Coefficients of each sub-filter (N / interp rounded up).*/
+    int     pos;        /*!< Position in delay line.*/
+    int     interp;     /*!< Interpolation factor.*/
+    int     decim;      /*!< Decimation factor.*/
+    int     phase;      /*!< Phase of the next output, in samples at interp times the input rate.*/
+    int16_t use_delay;  /*!< The delay line was allocated by init function.*/
+} fir_poly_f32_t;
+
 /**
  * @brief   initialize structure for 32 bit FIR filter
  *
@@ -79,6 +98,24 @@ typedef struct fir_s16_s {
  */
 esp_err_t dsps_fir_init_f32(fir_f32_t *fir, float *coeffs, float *delay, int coeffs_len);
 
+/**
+ * @brief   initialize structure for 32 bit FIR filter with mirrored delay line
+ *
+ * Function initialize structure for 32 bit floating point FIR filter used by dsps_fir_mirror_f32_ansi.
+ * The delay line has twice the filter length: each sample is stored at pos and pos + coeffs_len,
+ * so the last coeffs_len samples are always contiguous.
+ *
+ * @param fir: pointer to fir filter structure, that must be preallocated
+ * @param coeffs: array with FIR filter coefficients. Must be length coeffs_len
+ * @param delay: array for FIR filter delay line. Must have a length = 2 * coeffs_len, if NULL it is allocated
+ * @param coeffs_len: FIR filter length. Length of coeffs array.
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dsps_fir_mirror_init_f32(fir_f32_t *fir, float *coeffs, float *delay, int coeffs_len);
+
 /**
  * @brief   initialize structure for 32 bit Decimation FIR filter
  * Function initialize structure for 32 bit floating point FIR filter with decimation
@@ -115,6 +152,31 @@ esp_err_t dsps_fird_init_f32(fir_f32_t *fir, float *coeffs, float *delay, int N,
  */
 esp_err_t dsps_fird_init_s16(fir_s16_t *fir, int16_t *coeffs, int16_t *delay, int16_t coeffs_len, int16_t decim, int16_t start_pos, int16_t shift);
 
+/**
+ * @brief   initialize structure for 32 bit polyphase resampling FIR filter
+ *
+ * Function initialize structure for 32 bit floating point FIR filter that changes the sample rate
+ * by interp / decim: the input is interpolated by interp (zeros inserted), filtered and decimated
+ * by decim, but only the outputs that are kept are calculated, each one with N / interp coefficients.
+ * With interp = 1 it is a decimation filter (same result as dsps_fird_f32) and with decim = 1 an
+ * interpolation filter. The coefficients are given in the order of dsps_fir_init_f32 and are designed
+ * at interp times the input rate (for unity gain in interpolation they must add up to interp).
+ * The implementation use ANSI C and could be compiled and run on any platform
+ *
+ * @param fir: pointer to fir filter structure, that must be preallocated
+ * @param coeffs: array with FIR filter coefficients. Must be length coeffs_len. They are copied in polyphase order.
+ * @param delay: array for FIR filter delay line. Must have a length = coeffs_len / interp rounded up,
+ *               if NULL it is allocated.
+ * @param coeffs_len: FIR filter length. Length of coeffs array.
+ * @param interp: interpolation factor.
+ * @param decim: decimation factor.
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dsps_fir_poly_init_f32(fir_poly_f32_t *fir, const float *coeffs, float *delay, int coeffs_len, int interp, int decim);
+
 
 /**@{*/
 /**
@@ -138,6 +200,51 @@ esp_err_t dsps_fir_f32_ae32(fir_f32_t *fir, const float *input, float *output, i
 esp_err_t dsps_fir_f32_aes3(fir_f32_t *fir, const float *input, float *output, int len);
 /**@}*/
 
+/**@{*/
+/**
+ * @brief   32 bit floating point FIR filter with mirrored delay line
+ *
+ * Function implements FIR filter with the same coefficients and result as dsps_fir_f32, but each
+ * output is a single dot product over a contiguous window of the delay line, calculated with
+ * dsps_dotprod_f32 (so it uses the optimized kernel of the chip). The structure is initialized
+ * by dsps_fir_mirror_init_f32 and freed by dsps_fir_f32_free.
+ * It pays off from about 64 taps; for shorter filters dsps_fir_f32 is as fast or faster.
+ * The extension (_ansi) uses ANSI C and could be compiled and run on any platform.
+ *
+ * @param fir: pointer to fir filter structure, that must be initialized before
+ * @param[in] input: input array
+ * @param[out] output: array with the result of FIR filter
+ * @param[in] len: length of input and result arrays
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dsps_fir_mirror_f32_ansi(fir_f32_t *fir, const float *input, float *output, int len);
+/**@}*/
+
+/**@{*/
+/**
+ * @brief   32 bit floating point symmetric FIR filter
+ *
+ * Function implements FIR filter for symmetric coefficients (linear phase), coeffs[k] = coeffs[N - 1 - k].
+ * The two delay line samples that share a coefficient are added first, so only the first half of
+ * the coefficients is used and the number of multiplications is halved. The result is the same as
+ * dsps_fir_f32 (within rounding). The structure is initialized by dsps_fir_init_f32.
+ * The extension (_ansi) uses ANSI C and could be compiled and run on any platform.
+ *
+ * @param fir: pointer to fir filter structure, that must be initialized before
+ * @param[in] input: input array
+ * @param[out] output: array with the result of FIR filter
+ * @param[in] len: length of input and result arrays
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dsps_fir_sym_f32_ansi(fir_f32_t *fir, const float *input, float *output, int len);
+/**@}*/
+
 /**@{*/
 /**
  *  @brief   32 bit floating point Decimation FIR filter
@@ -158,6 +265,24 @@ int dsps_fird_f32_ansi(fir_f32_t *fir, const float *input, float *output, int le
 int dsps_fird_f32_ae32(fir_f32_t *fir, const float *input, float *output, int len);
 int dsps_fird_f32_aes3(fir_f32_t *fir, const float *input, float *output, int len);
 /**@}*/
+/**@{*/
+/**
+ *  @brief   32 bit floating point polyphase resampling FIR filter
+ *
+ * Function implements FIR filter with interpolation and decimation. Any number of input samples
+ * can be processed, the phase is kept between calls.
+ * The extension (_ansi) uses ANSI C and could be compiled and run on any platform.
+ *
+ * @param fir: pointer to fir filter structure, that must be initialized before
+ * @param input: input array
+ * @param output: array with the result of FIR filter, of length len * interp / decim rounded up
+ * @param len: length of input array
+ *
+ * @return: function returns the number of samples stored in the output array
+ */
+int dsps_fir_poly_f32_ansi(fir_poly_f32_t *fir, const float *input, float *output, int len);
+/**@}*/
+
 
 /**@{*/
 /**
@@ -181,6 +306,25 @@ int32_t dsps_fird_s16_aes3(fir_s16_t *fir, const int16_t *input, int16_t *output
 /**@}*/
 
 
+/**@{*/
+/**
+ *  @brief   16 bit signed fixed point symmetric Decimation FIR filter
+ *
+ * Function implements FIR filter with decimation for symmetric coefficients (linear phase),
+ * coeffs[k] = coeffs[coeffs_len - 1 - k]. Only the first half of the coefficients is used, the
+ * result is bit exact with dsps_fird_s16_ansi. The structure is initialized by dsps_fird_init_s16.
+ * The extension (_ansi) uses ANSI C and could be compiled and run on any platform.
+ *
+ * @param fir: pointer to fir filter structure, that must be initialized before
+ * @param input: input array
+ * @param output: array with the result of the FIR filter
+ * @param len: length of the result array
+ *
+ * @return: function returns the number of samples stored in the output array
+ */
+int32_t dsps_fird_sym_s16_ansi(fir_s16_t *fir, const int16_t *input, int16_t *output, int32_t len);
+/**@}*/
+
 /**@{*/
 /**
  * @brief   support arrays freeing function
@@ -214,6 +358,20 @@ esp_err_t dsps_fird_s16_aexx_free(fir_s16_t *fir);
 esp_err_t dsps_fir_f32_free(fir_f32_t *fir);
 /**@}*/
 
+/**@{*/
+/**
+ * @brief   support arrays freeing function
+ *
+ * Function frees the polyphase coefficients and the delay line, if it was allocated by the init function.
+ *
+ * @param fir: pointer to fir filter structure, that must be initialized before
+ *
+ * @return
+ *      - ESP_OK on success
+ */
+esp_err_t dsps_fir_poly_f32_free(fir_poly_f32_t *fir);
+/**@}*/
+
 
 /**@{*/
 /**
@@ -254,6 +412,11 @@ esp_err_t dsps_16_array_rev(int16_t *arr, int16_t len);
 #define dsps_fird_f32 dsps_fird_f32_ansi
 #endif
 
+#define dsps_fir_poly_f32 dsps_fir_poly_f32_ansi
+#define dsps_fir_sym_f32 dsps_fir_sym_f32_ansi
+#define dsps_fir_mirror_f32 dsps_fir_mirror_f32_ansi
+#define dsps_fird_sym_s16 dsps_fird_sym_s16_ansi
+
 #if (dsps_fird_s16_ae32_enabled == 1)
 #define dsps_fird_s16 dsps_fird_s16_ae32
 
@@ -268,7 +431,11 @@ esp_err_t dsps_16_array_rev(int16_t *arr, int16_t len);
 
 #define dsps_fir_f32 dsps_fir_f32_ansi
 #define dsps_fird_f32 dsps_fird_f32_ansi
+#define dsps_fir_poly_f32 dsps_fir_poly_f32_ansi
+#define dsps_fir_sym_f32 dsps_fir_sym_f32_ansi
+#define dsps_fir_mirror_f32 dsps_fir_mirror_f32_ansi
 #define dsps_fird_s16 dsps_fird_s16_ansi
+#define dsps_fird_sym_s16 dsps_fird_sym_s16_ansi
 
 #endif // CONFIG_DSP_OPTIMIZED
 
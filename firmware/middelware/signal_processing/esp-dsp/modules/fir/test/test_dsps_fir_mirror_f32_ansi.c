@@ -0,0 +1,93 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string.h>
+#include <stdlib.h>
+#include "unity.h"
+#include "esp_dsp.h"
+#include "dsp_platform.h"
+#include "esp_log.h"
+
+#include "dsps_fir.h"
+#include "dsp_tests.h"
+
+static const char *TAG = "dsps_fir_mirror_f32_ansi";
+
+#define LEN         1024
+#define MAX_TAPS    256
+#define MIN_TAPS    64
+
+static float x[LEN];
+static float y[LEN];
+static float check[LEN];
+static float coeffs[MAX_TAPS];
+static float delay[MAX_TAPS + 4];
+
+static void gen_signals(void)
+{
+    for (int i = 0 ; i < LEN ; i++) {
+        x[i] = (float)rand() / RAND_MAX - 0.5;
+    }
+    for (int i = 0 ; i < MAX_TAPS ; i++) {
+        coeffs[i] = (float)rand() / RAND_MAX - 0.5;
+    }
+}
+
+TEST_CASE("dsps_fir_mirror_f32_ansi functionality", "[dsps]")
+{
+    fir_f32_t fir;
+    fir_f32_t fir_check;
+    gen_signals();
+    const int taps[] = {1, 2, 7, 32, 100, 256};
+    for (int t = 0 ; t < sizeof(taps) / sizeof(taps[0]) ; t++) {
+        int N = taps[t];
+        TEST_ESP_OK(dsps_fir_mirror_init_f32(&fir, coeffs, NULL, N));
+        dsps_fir_init_f32(&fir_check, coeffs, delay, N);
+        dsps_fir_f32_ansi(&fir_check, x, check, LEN);
+        for (int i = 0 ; i < LEN ; i += 37) {
+            int n = (LEN - i < 37) ? (LEN - i) : 37;
+            dsps_fir_mirror_f32_ansi(&fir, &x[i], &y[i], n);
+        }
+        for (int i = 0 ; i < LEN ; i++) {
+            TEST_ASSERT_FLOAT_WITHIN(1e-5, check[i], y[i]);
+        }
+        dsps_fir_f32_free(&fir);
+    }
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_INVALID_LENGTH, dsps_fir_mirror_init_f32(&fir, coeffs, NULL, 0));
+}
+
+TEST_CASE("dsps_fir_mirror_f32_ansi benchmark", "[dsps]")
+{
+    fir_f32_t fir;
+    gen_signals();
+    for (int N = 16 ; N <= MAX_TAPS ; N *= 2) {
+        dsps_fir_init_f32(&fir, coeffs, delay, N);
+        unsigned int start_b = dsp_get_cpu_cycle_count();
+        dsps_fir_f32_ansi(&fir, x, check, LEN);
+        unsigned int end_b = dsp_get_cpu_cycle_count();
+        int cycles_fir = end_b - start_b;
+
+        TEST_ESP_OK(dsps_fir_mirror_init_f32(&fir, coeffs, NULL, N));
+        start_b = dsp_get_cpu_cycle_count();
+        dsps_fir_mirror_f32_ansi(&fir, x, y, LEN);
+        end_b = dsp_get_cpu_cycle_count();
+        int cycles_mirror = end_b - start_b;
+
+        ESP_LOGI(TAG, "%i taps, %i samples: dsps_fir_f32_ansi - %i cycles, dsps_fir_mirror_f32_ansi - %i cycles", N, LEN, cycles_fir, cycles_mirror);
+        // Not slower than dsps_fir_f32_ansi from MIN_TAPS on. Below that the extra store
+        // and the dsps_dotprod_f32 call cost about as much as the split loop saves
+        if (N >= MIN_TAPS) {
+            TEST_ASSERT_EXEC_IN_RANGE(1, cycles_fir + 1, cycles_mirror);
+        }
+        dsps_fir_f32_free(&fir);
+    }
+}
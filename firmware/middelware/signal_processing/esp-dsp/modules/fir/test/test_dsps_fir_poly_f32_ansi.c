@@ -0,0 +1,138 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string.h>
+#include <stdlib.h>
+#include "unity.h"
+#include "esp_dsp.h"
+#include "dsp_platform.h"
+#include "esp_log.h"
+
+#include "dsps_fir.h"
+#include "dsp_tests.h"
+
+static const char *TAG = "dsps_fir_poly_f32_ansi";
+
+#define IN_LEN      2000
+#define MAX_RATE    4
+#define FIR_LEN     64
+
+static float x[IN_LEN];
+static float up[IN_LEN * MAX_RATE];
+static float y[IN_LEN * MAX_RATE];
+static float check[IN_LEN * MAX_RATE];
+static float coeffs[FIR_LEN];
+static float delay[FIR_LEN + 4];
+
+static void gen_signals(void)
+{
+    for (int i = 0 ; i < IN_LEN ; i++) {
+        x[i] = (float)rand() / RAND_MAX - 0.5;
+    }
+    for (int i = 0 ; i < FIR_LEN ; i++) {
+        coeffs[i] = (float)rand() / RAND_MAX - 0.5;
+    }
+}
+
+// Reference: zeros inserted, full rate FIR filter and decimation
+static int reference(int interp, int decim)
+{
+    fir_f32_t fir;
+    memset(up, 0, sizeof(up));
+    for (int i = 0 ; i < IN_LEN ; i++) {
+        up[i * interp] = x[i];
+    }
+    dsps_fir_init_f32(&fir, coeffs, delay, FIR_LEN);
+    dsps_fir_f32_ansi(&fir, up, up, IN_LEN * interp);
+    int total = 0;
+    for (int t = decim - 1 ; t < IN_LEN * interp ; t += decim) {
+        check[total++] = up[t];
+    }
+    return total;
+}
+
+static void check_rates(int interp, int decim)
+{
+    fir_poly_f32_t fir;
+    TEST_ESP_OK(dsps_fir_poly_init_f32(&fir, coeffs, NULL, FIR_LEN, interp, decim));
+    int total = 0;
+    int chunk;
+    // Chunks of several lengths, not aligned with decim
+    for (int i = 0 ; i < IN_LEN ; i += chunk) {
+        chunk = 1 + (i * 7) % 61;
+        if (i + chunk > IN_LEN) {
+            chunk = IN_LEN - i;
+        }
+        total += dsps_fir_poly_f32_ansi(&fir, &x[i], &y[total], chunk);
+    }
+    int check_total = reference(interp, decim);
+    ESP_LOGD(TAG, "interp = %i, decim = %i: %i outputs", interp, decim, total);
+    TEST_ASSERT_EQUAL(check_total, total);
+    for (int i = 0 ; i < total ; i++) {
+        TEST_ASSERT_FLOAT_WITHIN(1e-5, check[i], y[i]);
+    }
+    dsps_fir_poly_f32_free(&fir);
+}
+
+TEST_CASE("dsps_fir_poly_f32_ansi functionality", "[dsps]")
+{
+    fir_poly_f32_t fir;
+    fir_f32_t fird;
+    gen_signals();
+    // Decimation, same as dsps_fird_f32_ansi (2 kHz to 250 Hz)
+    TEST_ESP_OK(dsps_fir_poly_init_f32(&fir, coeffs, NULL, FIR_LEN, 1, 8));
+    dsps_fird_init_f32(&fird, coeffs, delay, FIR_LEN, 8);
+    int total = dsps_fird_f32_ansi(&fird, x, check, IN_LEN / 8);
+    TEST_ASSERT_EQUAL(total, dsps_fir_poly_f32_ansi(&fir, x, y, IN_LEN));
+    for (int i = 0 ; i < total ; i++) {
+        TEST_ASSERT_EQUAL_FLOAT(check[i], y[i]);
+    }
+    dsps_fir_poly_f32_free(&fir);
+    // Decimation, interpolation and rational factors
+    const int rates[][2] = {{1, 1}, {1, 8}, {1, 3}, {4, 1}, {3, 1}, {3, 2}, {2, 3}, {4, 3}, {3, 8}};
+    for (int i = 0 ; i < sizeof(rates) / sizeof(rates[0]) ; i++) {
+        check_rates(rates[i][0], rates[i][1]);
+    }
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_INVALID_PARAM, dsps_fir_poly_init_f32(&fir, coeffs, NULL, FIR_LEN, 0, 1));
+}
+
+TEST_CASE("dsps_fir_poly_f32_ansi benchmark", "[dsps]")
+{
+    fir_poly_f32_t fir;
+    fir_f32_t fir_full;
+    gen_signals();
+    const int rates[][2] = {{1, 8}, {4, 1}, {3, 2}};
+    for (int i = 0 ; i < sizeof(rates) / sizeof(rates[0]) ; i++) {
+        int interp = rates[i][0];
+        int decim = rates[i][1];
+        TEST_ESP_OK(dsps_fir_poly_init_f32(&fir, coeffs, NULL, FIR_LEN, interp, decim));
+        dsps_fir_init_f32(&fir_full, coeffs, delay, FIR_LEN);
+        // Full rate filter of the signal with zeros inserted, as it was needed before
+        memset(up, 0, sizeof(up));
+        for (int n = 0 ; n < IN_LEN ; n++) {
+            up[n * interp] = x[n];
+        }
+        unsigned int start_b = dsp_get_cpu_cycle_count();
+        dsps_fir_f32_ansi(&fir_full, up, check, IN_LEN * interp);
+        unsigned int end_b = dsp_get_cpu_cycle_count();
+        int cycles_full = end_b - start_b;
+
+        start_b = dsp_get_cpu_cycle_count();
+        dsps_fir_poly_f32_ansi(&fir, x, y, IN_LEN);
+        end_b = dsp_get_cpu_cycle_count();
+        int cycles_poly = end_b - start_b;
+
+        ESP_LOGI(TAG, "%i/%i, %i taps: full rate - %i cycles, polyphase - %i cycles", interp, decim, FIR_LEN, cycles_full, cycles_poly);
+        TEST_ASSERT_EXEC_IN_RANGE(1, cycles_full, cycles_poly);
+        dsps_fir_poly_f32_free(&fir);
+    }
+}
@@ -0,0 +1,101 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string.h>
+#include <stdlib.h>
+#include "unity.h"
+#include "esp_dsp.h"
+#include "dsp_platform.h"
+#include "esp_log.h"
+
+#include "dsps_fir.h"
+#include "dsp_tests.h"
+
+static const char *TAG = "dsps_fird_sym_s16_ansi";
+
+#define LEN         1024
+#define MAX_TAPS    255
+
+static int16_t x[LEN];
+static int16_t y[LEN];
+static int16_t check[LEN];
+static int16_t coeffs[MAX_TAPS];
+static int16_t delay[MAX_TAPS];
+static int16_t delay_check[MAX_TAPS];
+
+static void gen_signals(int taps, bool full_scale)
+{
+    for (int i = 0 ; i < LEN ; i++) {
+        x[i] = full_scale ? ((i & 1) ? INT16_MIN : INT16_MAX) : (rand() % 65536) - 32768;
+    }
+    for (int i = 0 ; i < (taps + 1) / 2 ; i++) {
+        coeffs[i] = full_scale ? INT16_MIN : (rand() % 65536) - 32768;
+        coeffs[taps - 1 - i] = coeffs[i];
+    }
+}
+
+static void check_filter(int N, int decim, int shift, bool full_scale)
+{
+    fir_s16_t fir;
+    fir_s16_t fir_check;
+    gen_signals(N, full_scale);
+    TEST_ESP_OK(dsps_fird_init_s16(&fir, coeffs, delay, N, decim, 0, shift));
+    TEST_ESP_OK(dsps_fird_init_s16(&fir_check, coeffs, delay_check, N, decim, 0, shift));
+    int total = dsps_fird_s16_ansi(&fir_check, x, check, LEN / decim);
+    // Several calls, so the delay line wraps at every position
+    int result = 0;
+    for (int i = 0 ; i < LEN / decim ; i += 13) {
+        int n = (LEN / decim - i < 13) ? (LEN / decim - i) : 13;
+        result += dsps_fird_sym_s16_ansi(&fir, &x[i * decim], &y[i], n);
+    }
+    TEST_ASSERT_EQUAL(total, result);
+    for (int i = 0 ; i < total ; i++) {
+        TEST_ASSERT_EQUAL_INT16(check[i], y[i]);
+    }
+    dsps_fird_s16_aexx_free(&fir);
+    dsps_fird_s16_aexx_free(&fir_check);
+}
+
+TEST_CASE("dsps_fird_sym_s16_ansi functionality", "[dsps]")
+{
+    // Odd and even lengths, with and without decimation
+    const int taps[] = {2, 3, 4, 16, 31, 64, 255};
+    for (int t = 0 ; t < sizeof(taps) / sizeof(taps[0]) ; t++) {
+        check_filter(taps[t], 1, 0, false);
+        check_filter(taps[t], 3, 8, false);
+        // Pre-added pairs out of the 16 bit range
+        check_filter(taps[t], 2, 16, true);
+    }
+}
+
+TEST_CASE("dsps_fird_sym_s16_ansi benchmark", "[dsps]")
+{
+    fir_s16_t fir;
+    for (int N = 31 ; N <= MAX_TAPS ; N = 2 * N + 1) {
+        gen_signals(N, false);
+        dsps_fird_init_s16(&fir, coeffs, delay, N, 1, 0, 0);
+        unsigned int start_b = dsp_get_cpu_cycle_count();
+        dsps_fird_s16_ansi(&fir, x, check, LEN);
+        unsigned int end_b = dsp_get_cpu_cycle_count();
+        int cycles_fir = end_b - start_b;
+
+        dsps_fird_init_s16(&fir, coeffs, delay, N, 1, 0, 0);
+        start_b = dsp_get_cpu_cycle_count();
+        dsps_fird_sym_s16_ansi(&fir, x, y, LEN);
+        end_b = dsp_get_cpu_cycle_count();
+        int cycles_sym = end_b - start_b;
+
+        ESP_LOGI(TAG, "%i taps: dsps_fird_s16_ansi - %i cycles/sample, dsps_fird_sym_s16_ansi - %i cycles/sample", N, cycles_fir / LEN, cycles_sym / LEN);
+        TEST_ASSERT_EXEC_IN_RANGE(1, cycles_fir, cycles_sym);
+        dsps_fird_s16_aexx_free(&fir);
+    }
+}
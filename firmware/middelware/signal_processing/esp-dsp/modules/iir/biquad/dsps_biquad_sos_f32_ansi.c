@@ -0,0 +1,37 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "dsps_biquad.h"
+
+
+esp_err_t dsps_biquad_sos_f32_ansi(const float *input, float *output, int len, float *coef, float *w, int n_sections)
+{
+    if (n_sections <= 0) {
+        return ESP_ERR_DSP_INVALID_PARAM;
+    }
+    for (int i = 0 ; i < len ; i++) {
+        float x = input[i];
+        float *c = coef;
+        float *d = w;
+        for (int k = 0 ; k < n_sections ; k++) {
+            float d0 = x - c[3] * d[0] - c[4] * d[1];
+            x = c[0] * d0 + c[1] * d[0] + c[2] * d[1];
+            d[1] = d[0];
+            d[0] = d0;
+            c += 5;
+            d += 2;
+        }
+        output[i] = x;
+    }
+    return ESP_OK;
+}
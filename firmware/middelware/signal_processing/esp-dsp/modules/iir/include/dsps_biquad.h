@@ -48,6 +48,30 @@ esp_err_t dsps_biquad_f32_ae32(const float *input, float *output, int len, float
 esp_err_t dsps_biquad_f32_aes3(const float *input, float *output, int len, float *coef, float *w);
 /**@}*/
 
+/**@{*/
+/**
+ * @brief   Cascade of IIR filters
+ *
+ * Cascade of n_sections 2nd order direct form II sections (bi quads), computed in a single
+ * pass: every sample goes through all the sections before the next one is read, so the
+ * intermediate results are never stored to the output array.
+ * Gives the same result as calling dsps_biquad_f32 once per section.
+ * The extension (_ansi) use ANSI C and could be compiled and run on any platform.
+ *
+ * @param[in] input: input array
+ * @param output: output array (could be the same as input)
+ * @param len: length of input and output vectors
+ * @param coef: array of coefficients. b0,b1,b2,a1,a2 of each section, one after the other.
+ *              Length of 5 * n_sections.
+ * @param w: delay lines w0,w1 of each section, one after the other. Length of 2 * n_sections.
+ * @param n_sections: number of 2nd order sections
+ * @return
+ *      - ESP_OK on success
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dsps_biquad_sos_f32_ansi(const float *input, float *output, int len, float *coef, float *w, int n_sections);
+/**@}*/
+
 
 #ifdef __cplusplus
 }
@@ -62,10 +86,12 @@ esp_err_t dsps_biquad_f32_aes3(const float *input, float *output, int len, float
 #else
 #define dsps_biquad_f32 dsps_biquad_f32_ansi
 #endif
+#define dsps_biquad_sos_f32 dsps_biquad_sos_f32_ansi
 
 #else // CONFIG_DSP_OPTIMIZED
 
 #define dsps_biquad_f32 dsps_biquad_f32_ansi
+#define dsps_biquad_sos_f32 dsps_biquad_sos_f32_ansi
 
 #endif // CONFIG_DSP_OPTIMIZED
 
@@ -0,0 +1,104 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string.h>
+#include "unity.h"
+#include "dsp_platform.h"
+#include "esp_log.h"
+
+#include "dsp_common.h"
+#include "dsps_tone_gen.h"
+#include "dsps_biquad_gen.h"
+#include "dsps_biquad.h"
+#include "dsp_tests.h"
+
+static const char *TAG = "dsps_biquad_sos_f32_ansi";
+
+#define MAX_SECTIONS 4
+
+static float x[1024];
+static float y[1024];
+static float y_ref[1024];
+
+// 8th order Butterworth low pass, cut off frequency 0.05
+static void gen_cascade(float *coeffs)
+{
+    for (int k = 0 ; k < MAX_SECTIONS ; k++) {
+        float q = 1 / (2 * sinf((2 * k + 1) * M_PI / (4 * MAX_SECTIONS)));
+        dsps_biquad_gen_lpf_f32(&coeffs[k * 5], 0.05, q);
+    }
+}
+
+TEST_CASE("dsps_biquad_sos_f32_ansi functionality", "[dsps]")
+{
+    // The cascade must give the same result as one dsps_biquad_f32_ansi call per section
+    int len = sizeof(x) / sizeof(float);
+    float coeffs[MAX_SECTIONS * 5];
+    float w[MAX_SECTIONS * 2] = {0};
+    float w_ref[MAX_SECTIONS * 2] = {0};
+    gen_cascade(coeffs);
+
+    for (int i = 0 ; i < len ; i++) {
+        x[i] = (float)rand() / RAND_MAX - 0.5;
+    }
+    // Two calls, to check that the delay lines are kept between them
+    for (int part = 0 ; part < 2 ; part++) {
+        float *in = &x[part * len / 2];
+        dsps_biquad_f32_ansi(in, &y_ref[part * len / 2], len / 2, coeffs, w_ref);
+        for (int k = 1 ; k < MAX_SECTIONS ; k++) {
+            dsps_biquad_f32_ansi(&y_ref[part * len / 2], &y_ref[part * len / 2], len / 2, &coeffs[k * 5], &w_ref[k * 2]);
+        }
+        dsps_biquad_sos_f32_ansi(in, &y[part * len / 2], len / 2, coeffs, w, MAX_SECTIONS);
+    }
+    // Same operations in the same order, only the rounding of the intermediate values may differ
+    for (int i = 0 ; i < len ; i++) {
+        TEST_ASSERT_FLOAT_WITHIN(1e-6, y_ref[i], y[i]);
+    }
+    // In place
+    memcpy(y, x, sizeof(x));
+    memset(w, 0, sizeof(w));
+    dsps_biquad_sos_f32_ansi(y, y, len, coeffs, w, MAX_SECTIONS);
+    for (int i = 0 ; i < len ; i++) {
+        TEST_ASSERT_FLOAT_WITHIN(1e-6, y_ref[i], y[i]);
+    }
+
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_INVALID_PARAM, dsps_biquad_sos_f32_ansi(x, y, len, coeffs, w, 0));
+}
+
+TEST_CASE("dsps_biquad_sos_f32_ansi benchmark", "[dsps]")
+{
+    int len = sizeof(x) / sizeof(float);
+    float coeffs[MAX_SECTIONS * 5];
+    float w[MAX_SECTIONS * 2] = {0};
+    gen_cascade(coeffs);
+    dsps_tone_gen_f32(x, len, 1, 0.01, 0);
+
+    for (int n = 1 ; n <= MAX_SECTIONS ; n++) {
+        unsigned int start_b = dsp_get_cpu_cycle_count();
+        dsps_biquad_f32(x, y, len, coeffs, w);
+        for (int k = 1 ; k < n ; k++) {
+            dsps_biquad_f32(y, y, len, &coeffs[k * 5], &w[k * 2]);
+        }
+        unsigned int end_b = dsp_get_cpu_cycle_count();
+        float cycles_sections = (float)(end_b - start_b) / len;
+
+        start_b = dsp_get_cpu_cycle_count();
+        dsps_biquad_sos_f32_ansi(x, y, len, coeffs, w, n);
+        end_b = dsp_get_cpu_cycle_count();
+        float cycles_sos = (float)(end_b - start_b) / len;
+
+        ESP_LOGI(TAG, "%i sections: dsps_biquad_f32 per section - %f cycles per sample, dsps_biquad_sos_f32_ansi - %f cycles per sample", n, cycles_sections, cycles_sos);
+        float min_exec = 1;
+        float max_exec = 100 * n;
+        TEST_ASSERT_EXEC_IN_RANGE(min_exec, max_exec, cycles_sos);
+    }
+}
@@ -21,5 +21,7 @@
 #include "dsps_addc.h"
 #include "dsps_mulc.h"
 #include "dsps_sqrt.h"
+#include "dsps_mag.h"
+#include "dsps_movstat.h"
 
 #endif // _dsps_math_H_
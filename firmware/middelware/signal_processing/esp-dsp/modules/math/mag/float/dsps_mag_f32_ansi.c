@@ -0,0 +1,95 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dsps_mag.h"
+#include <stdint.h>
+#include <math.h>
+
+// 10 * log10(2)
+#define DB_PER_OCTAVE   3.0102999566f
+// Power saturation (-200 dB)
+#define POWER_MIN       1e-20f
+
+// log2(x) for x > 0 (normal numbers), max error ~ 2e-6
+static inline float dsps_log2f(float x)
+{
+    union {
+        float f;
+        uint32_t i;
+    } conv = {x};
+    float e = (float)((int)((conv.i >> 23) & 0xff) - 127);
+    // Mantissa in [sqrt(0.5), sqrt(2))
+    conv.i = (conv.i & 0x007fffff) | 0x3f800000;
+    if (conv.f > 1.41421356f) {
+        conv.f *= 0.5f;
+        e += 1;
+    }
+    // log2(m) = 2/ln(2) * (t + t^3/3 + t^5/5 + ...), t = (m - 1) / (m + 1)
+    float t = (conv.f - 1) / (conv.f + 1);
+    float t2 = t * t;
+    return e + t * (2.8853900818f + t2 * (0.9617966939f + t2 * 0.5770780164f));
+}
+
+esp_err_t dsps_mag_fc32_ansi(const float *input, float *output, int len, float scale)
+{
+    if (NULL == input) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    if (NULL == output) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+
+    for (int i = 0 ; i < len ; i++) {
+        float re = input[i * 2 + 0];
+        float im = input[i * 2 + 1];
+        output[i] = scale * sqrtf(re * re + im * im);
+    }
+    return ESP_OK;
+}
+
+esp_err_t dsps_power_fc32_ansi(const float *input, float *output, int len, float scale)
+{
+    if (NULL == input) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    if (NULL == output) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+
+    for (int i = 0 ; i < len ; i++) {
+        float re = input[i * 2 + 0];
+        float im = input[i * 2 + 1];
+        output[i] = scale * (re * re + im * im);
+    }
+    return ESP_OK;
+}
+
+esp_err_t dsps_power_db_fc32_ansi(const float *input, float *output, int len, float scale)
+{
+    if (NULL == input) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    if (NULL == output) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+
+    for (int i = 0 ; i < len ; i++) {
+        float re = input[i * 2 + 0];
+        float im = input[i * 2 + 1];
+        float power = scale * (re * re + im * im);
+        if (!(power > POWER_MIN)) {
+            power = POWER_MIN;
+        }
+        output[i] = DB_PER_OCTAVE * dsps_log2f(power);
+    }
+    return ESP_OK;
+}
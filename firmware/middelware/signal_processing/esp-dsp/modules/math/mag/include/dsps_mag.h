@@ -0,0 +1,101 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _dsps_mag_H_
+#define _dsps_mag_H_
+#include "dsp_err.h"
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**@{*/
+/**
+ * @brief   magnitude of a complex array
+ *
+ * The function calculates the scaled magnitude of a complex array
+ * out[i] = scale * sqrt(Re[i]^2 + Im[i]^2); i=[0..len)
+ * Only single precision operations are used.
+ * The implementation use ANSI C and could be compiled and run on any platform
+ *
+ * @param[in] input: input complex array. An elements located: Re[0], Im[0], ... Re[len-1], Im[len-1]
+ * @param output: output array (can be the same as input)
+ * @param len: amount of complex elements
+ * @param scale: scale factor applied to the magnitude
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dsps_mag_fc32_ansi(const float *input, float *output, int len, float scale);
+/**@}*/
+
+/**@{*/
+/**
+ * @brief   power of a complex array
+ *
+ * The function calculates the scaled power of a complex array, without square root
+ * out[i] = scale * (Re[i]^2 + Im[i]^2); i=[0..len)
+ * The implementation use ANSI C and could be compiled and run on any platform
+ *
+ * @param[in] input: input complex array. An elements located: Re[0], Im[0], ... Re[len-1], Im[len-1]
+ * @param output: output array (can be the same as input)
+ * @param len: amount of complex elements
+ * @param scale: scale factor applied to the power
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dsps_power_fc32_ansi(const float *input, float *output, int len, float scale);
+/**@}*/
+
+/**@{*/
+/**
+ * @brief   power of a complex array in dB
+ *
+ * The function calculates the scaled power of a complex array in dB
+ * out[i] = 10 * log10(scale * (Re[i]^2 + Im[i]^2)); i=[0..len)
+ * The logarithm is approximated (error < 0.0001 dB) without calling log10f().
+ * Values below -200 dB are saturated.
+ * The implementation use ANSI C and could be compiled and run on any platform
+ *
+ * @param[in] input: input complex array. An elements located: Re[0], Im[0], ... Re[len-1], Im[len-1]
+ * @param output: output array (can be the same as input)
+ * @param len: amount of complex elements
+ * @param scale: scale factor applied to the power (before the logarithm)
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dsps_power_db_fc32_ansi(const float *input, float *output, int len, float scale);
+/**@}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#ifdef CONFIG_DSP_OPTIMIZED
+#define dsps_mag_fc32 dsps_mag_fc32_ansi
+#define dsps_power_fc32 dsps_power_fc32_ansi
+#define dsps_power_db_fc32 dsps_power_db_fc32_ansi
+#else
+#define dsps_mag_fc32 dsps_mag_fc32_ansi
+#define dsps_power_fc32 dsps_power_fc32_ansi
+#define dsps_power_db_fc32 dsps_power_db_fc32_ansi
+#endif
+
+#endif // _dsps_mag_H_
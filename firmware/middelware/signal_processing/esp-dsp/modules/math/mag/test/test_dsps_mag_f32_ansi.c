@@ -0,0 +1,112 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string.h>
+#include "unity.h"
+#include "dsp_platform.h"
+#include "esp_log.h"
+
+#include "dsp_common.h"
+#include "dsps_mag.h"
+#include "dsp_tests.h"
+
+static const char *TAG = "dsps_mag";
+
+#define N 1024
+
+static float x[2 * N];
+static float y[2 * N];
+
+TEST_CASE("dsps_mag_fc32_ansi functionality", "[dsps]")
+{
+    float scale = 0.125;
+    for (int i = 0 ; i < 2 * N ; i++) {
+        x[i] = ((float)rand() / RAND_MAX - 0.5) * 1000;
+    }
+    TEST_ESP_OK(dsps_mag_fc32_ansi(x, y, N, scale));
+    for (int i = 0 ; i < N ; i++) {
+        float expected = scale * sqrt((double)x[2 * i] * x[2 * i] + (double)x[2 * i + 1] * x[2 * i + 1]);
+        TEST_ASSERT_FLOAT_WITHIN(expected * 1e-6 + 1e-6, expected, y[i]);
+    }
+    TEST_ESP_OK(dsps_power_fc32_ansi(x, y, N, scale));
+    for (int i = 0 ; i < N ; i++) {
+        float expected = scale * (x[2 * i] * x[2 * i] + x[2 * i + 1] * x[2 * i + 1]);
+        TEST_ASSERT_FLOAT_WITHIN(expected * 1e-6, expected, y[i]);
+    }
+    // In place
+    memcpy(y, x, sizeof(x));
+    TEST_ESP_OK(dsps_mag_fc32_ansi(y, y, N, 1));
+    TEST_ASSERT_FLOAT_WITHIN(1e-3, sqrtf(x[2 * N - 2] * x[2 * N - 2] + x[2 * N - 1] * x[2 * N - 1]), y[N - 1]);
+
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_PARAM_OUTOFRANGE, dsps_mag_fc32_ansi(NULL, y, N, 1));
+}
+
+TEST_CASE("dsps_power_db_fc32_ansi functionality", "[dsps]")
+{
+    float max_err = 0;
+    // Values over the full range of the input, including zero
+    for (int i = 0 ; i < N ; i++) {
+        x[2 * i + 0] = powf(10, (float)(i % 256) / 16 - 8) * ((float)rand() / RAND_MAX);
+        x[2 * i + 1] = powf(10, (float)(i % 128) / 16 - 4) * ((float)rand() / RAND_MAX - 0.5);
+    }
+    x[0] = 0;
+    x[1] = 0;
+    TEST_ESP_OK(dsps_power_db_fc32_ansi(x, y, N, 2));
+    TEST_ASSERT_EQUAL(-200, roundf(y[0]));
+    for (int i = 1 ; i < N ; i++) {
+        double power = 2 * ((double)x[2 * i] * x[2 * i] + (double)x[2 * i + 1] * x[2 * i + 1]);
+        if (power < 1e-20) {
+            continue;
+        }
+        float err = fabs(10 * log10(power) - y[i]);
+        if (err > max_err) {
+            max_err = err;
+        }
+    }
+    ESP_LOGI(TAG, "dsps_power_db_fc32_ansi: max error = %f dB", max_err);
+    TEST_ASSERT_TRUE(max_err < 1e-4f);
+}
+
+TEST_CASE("dsps_mag_fc32_ansi benchmark", "[dsps]")
+{
+    for (int i = 0 ; i < 2 * N ; i++) {
+        x[i] = (float)rand() / RAND_MAX;
+    }
+    float scale = 2.0 / N;
+
+    unsigned int start_b = dsp_get_cpu_cycle_count();
+    for (int i = 0 ; i < N ; i++) {
+        y[i] = 2 * (sqrt(x[i * 2 + 0] * x[i * 2 + 0] + x[i * 2 + 1] * x[i * 2 + 1])) / (N / 2);
+    }
+    unsigned int end_b = dsp_get_cpu_cycle_count();
+    float cycles_loop = (float)(end_b - start_b) / N;
+
+    start_b = dsp_get_cpu_cycle_count();
+    dsps_mag_fc32_ansi(x, y, N, scale);
+    end_b = dsp_get_cpu_cycle_count();
+    float cycles_mag = (float)(end_b - start_b) / N;
+
+    start_b = dsp_get_cpu_cycle_count();
+    dsps_power_fc32_ansi(x, y, N, scale);
+    end_b = dsp_get_cpu_cycle_count();
+    float cycles_power = (float)(end_b - start_b) / N;
+
+    start_b = dsp_get_cpu_cycle_count();
+    dsps_power_db_fc32_ansi(x, y, N, scale);
+    end_b = dsp_get_cpu_cycle_count();
+    float cycles_db = (float)(end_b - start_b) / N;
+
+    ESP_LOGI(TAG, "Cycles per element: double sqrt loop - %f, dsps_mag_fc32_ansi - %f, dsps_power_fc32_ansi - %f, dsps_power_db_fc32_ansi - %f",
+             cycles_loop, cycles_mag, cycles_power, cycles_db);
+    TEST_ASSERT_EXEC_IN_RANGE(1, 1000, cycles_mag);
+    TEST_ASSERT_EXEC_IN_RANGE(1, 1000, cycles_db);
+}
@@ -0,0 +1,72 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dsps_movstat.h"
+
+// Monotonic deque: positions of the samples that can still be the maximum (minimum) of the window,
+// from the oldest to the newest, with decreasing (increasing) values
+static inline esp_err_t dsps_movminmax(movstat_f32_t *mov, const float *input, float *output, int len, float sign)
+{
+    if ((NULL == input) || (NULL == output)) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    const int N = mov->N;
+    int back;
+    float x;
+    for (int i = 0 ; i < len ; i++) {
+        x = input[i];
+        if (mov->count < N) {
+            mov->count++;
+        } else if ((mov->size > 0) && (mov->deque[mov->head] == mov->pos)) {
+            // The oldest candidate leaves the window
+            mov->head++;
+            if (mov->head >= N) {
+                mov->head = 0;
+            }
+            mov->size--;
+        }
+        mov->delay[mov->pos] = x;
+        // Candidates that are not larger (smaller) than the new sample will never be the result
+        while (mov->size > 0) {
+            back = mov->head + mov->size - 1;
+            if (back >= N) {
+                back -= N;
+            }
+            if (sign * mov->delay[mov->deque[back]] > sign * x) {
+                break;
+            }
+            mov->size--;
+        }
+        back = mov->head + mov->size;
+        if (back >= N) {
+            back -= N;
+        }
+        mov->deque[back] = mov->pos;
+        mov->size++;
+        output[i] = mov->delay[mov->deque[mov->head]];
+        mov->pos++;
+        if (mov->pos >= N) {
+            mov->pos = 0;
+        }
+    }
+    return ESP_OK;
+}
+
+esp_err_t dsps_movmax_f32_ansi(movstat_f32_t *mov, const float *input, float *output, int len)
+{
+    return dsps_movminmax(mov, input, output, len, 1);
+}
+
+esp_err_t dsps_movmin_f32_ansi(movstat_f32_t *mov, const float *input, float *output, int len)
+{
+    return dsps_movminmax(mov, input, output, len, -1);
+}
@@ -0,0 +1,66 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <stdlib.h>
+#include "dsps_movstat.h"
+
+esp_err_t dsps_movstat_init_f32(movstat_f32_t *mov, float *delay, int N)
+{
+    if (N <= 0) {
+        return ESP_ERR_DSP_INVALID_LENGTH;
+    }
+    mov->deque = (int *)malloc(N * sizeof(int));
+    if (mov->deque == NULL) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    // Allocate delay line in case if it's NULL
+    if (delay == NULL) {
+        delay = (float *)malloc(N * sizeof(float));
+        if (delay == NULL) {
+            free(mov->deque);
+            mov->deque = NULL;
+            return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+        }
+        mov->use_delay = 1;
+    } else {
+        mov->use_delay = 0;
+    }
+    mov->delay = delay;
+    mov->N = N;
+    dsps_movstat_reset_f32(mov);
+    return ESP_OK;
+}
+
+void dsps_movstat_reset_f32(movstat_f32_t *mov)
+{
+    for (int i = 0 ; i < mov->N ; i++) {
+        mov->delay[i] = 0;
+    }
+    mov->pos = 0;
+    mov->count = 0;
+    mov->acc = 0;
+    mov->m2 = 0;
+    mov->shift = 0;
+    mov->head = 0;
+    mov->size = 0;
+}
+
+esp_err_t dsps_movstat_f32_free(movstat_f32_t *mov)
+{
+    if (mov->use_delay != 0) {
+        free(mov->delay);
+    }
+    free(mov->deque);
+    mov->delay = NULL;
+    mov->deque = NULL;
+    return ESP_OK;
+}
@@ -0,0 +1,73 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dsps_movstat.h"
+#include <math.h>
+
+// Add a sample to the window and return the sum of the window
+static inline float dsps_movsum_push(movstat_f32_t *mov, float x)
+{
+    if (mov->count < mov->N) {
+        mov->count++;
+        mov->acc += x;
+    } else {
+        mov->acc += x - mov->delay[mov->pos];
+    }
+    mov->delay[mov->pos] = x;
+    mov->pos++;
+    if (mov->pos >= mov->N) {
+        mov->pos = 0;
+        // Once per window the sum is calculated again, so rounding errors don't accumulate
+        float acc = 0;
+        for (int i = 0 ; i < mov->N ; i++) {
+            acc += mov->delay[i];
+        }
+        mov->acc = acc;
+    }
+    return mov->acc;
+}
+
+esp_err_t dsps_movsum_f32_ansi(movstat_f32_t *mov, const float *input, float *output, int len)
+{
+    if ((NULL == input) || (NULL == output)) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    for (int i = 0 ; i < len ; i++) {
+        output[i] = dsps_movsum_push(mov, input[i]);
+    }
+    return ESP_OK;
+}
+
+esp_err_t dsps_movmean_f32_ansi(movstat_f32_t *mov, const float *input, float *output, int len)
+{
+    if ((NULL == input) || (NULL == output)) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    for (int i = 0 ; i < len ; i++) {
+        output[i] = dsps_movsum_push(mov, input[i]) / mov->count;
+    }
+    return ESP_OK;
+}
+
+esp_err_t dsps_movrms_f32_ansi(movstat_f32_t *mov, const float *input, float *output, int len)
+{
+    if ((NULL == input) || (NULL == output)) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    float acc;
+    for (int i = 0 ; i < len ; i++) {
+        // The window keeps the squared samples
+        acc = dsps_movsum_push(mov, input[i] * input[i]);
+        output[i] = (acc > 0) ? sqrtf(acc / mov->count) : 0;
+    }
+    return ESP_OK;
+}
@@ -0,0 +1,62 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dsps_movstat.h"
+
+esp_err_t dsps_movvar_f32_ansi(movstat_f32_t *mov, const float *input, float *output, int len)
+{
+    if ((NULL == input) || (NULL == output)) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    float shift = mov->shift;
+    float acc = mov->acc;
+    float m2 = mov->m2;
+    float d, old;
+    for (int i = 0 ; i < len ; i++) {
+        if (mov->count == 0) {
+            // Until the window is filled the samples are taken relative to the first one
+            shift = input[i];
+        }
+        d = input[i] - shift;
+        if (mov->count < mov->N) {
+            mov->count++;
+        } else {
+            // The oldest sample leaves the window
+            old = mov->delay[mov->pos] - shift;
+            acc -= old;
+            m2 -= old * old;
+        }
+        acc += d;
+        m2 += d * d;
+        mov->delay[mov->pos] = input[i];
+        mov->pos++;
+        if (mov->pos >= mov->N) {
+            mov->pos = 0;
+            // Once per window the shift is moved to the mean and the sums are calculated again,
+            // so they stay small and rounding errors don't accumulate
+            shift += acc / mov->N;
+            acc = 0;
+            m2 = 0;
+            for (int j = 0 ; j < mov->N ; j++) {
+                d = mov->delay[j] - shift;
+                acc += d;
+                m2 += d * d;
+            }
+        }
+        d = (m2 - acc * acc / mov->count) / mov->count;
+        output[i] = (d > 0) ? d : 0;
+    }
+    mov->shift = shift;
+    mov->acc = acc;
+    mov->m2 = m2;
+    return ESP_OK;
+}
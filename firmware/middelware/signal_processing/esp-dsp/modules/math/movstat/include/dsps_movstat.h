@@ -0,0 +1,164 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _dsps_movstat_H_
+#define _dsps_movstat_H_
+#include "dsp_err.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief Data struct of the moving window statistics
+ *
+ * This structure is used by the moving window statistics internally. A user should access this
+ * structure only in case of extensions for the DSP Library.
+ * All fields of this structure are initialized by the dsps_movstat_init_f32(...) function.
+ * One structure holds the window of one statistic: it must be used with only one of the
+ * dsps_mov*_f32 functions.
+ */
+typedef struct movstat_f32_s {
+    float *delay;       /*!< Last N input samples (ring buffer)*/
+    int N;              /*!< Window length*/
+    int pos;            /*!< Position of the next sample in delay*/
+    int count;          /*!< Samples in the window (less than N only at start)*/
+    float acc;          /*!< Sum of the window (sum of squares for RMS, sum of differences from shift for variance)*/
+    float m2;           /*!< Sum of squared differences from shift (variance)*/
+    float shift;        /*!< Mean of the window when it was last filled (variance)*/
+    int *deque;         /*!< Positions in delay of the min/max candidates (N)*/
+    int head;           /*!< First element of deque (the current min/max)*/
+    int size;           /*!< Elements in deque*/
+    int16_t use_delay;  /*!< The delay line was allocated by init function*/
+} movstat_f32_t;
+
+/**
+ * @brief   initialize structure for moving window statistics
+ *
+ * Function initializes the window used by dsps_movsum_f32, dsps_movmean_f32, dsps_movrms_f32,
+ * dsps_movvar_f32, dsps_movmax_f32 and dsps_movmin_f32.
+ * dsps_movstat_f32_free(...) must be called once the structure is not needed anymore.
+ *
+ * @param mov: pointer to the moving window structure
+ * @param delay: array for the window of length N, or NULL to allocate it
+ * @param N: window length
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dsps_movstat_init_f32(movstat_f32_t *mov, float *delay, int N);
+
+/**
+ * @brief   clear the window
+ *
+ * @param mov: pointer to the moving window structure
+ */
+void dsps_movstat_reset_f32(movstat_f32_t *mov);
+
+/**
+ * @brief   free the moving window structure
+ *
+ * @param mov: pointer to the moving window structure
+ *
+ * @return
+ *      - ESP_OK on success
+ */
+esp_err_t dsps_movstat_f32_free(movstat_f32_t *mov);
+
+/**@{*/
+/**
+ * @brief   moving window sum, mean and RMS
+ *
+ * output[i] is the sum, mean or RMS of the last N input samples (of the samples received so far
+ * at start), including input[i]. The running sum is updated with the sample that enters the window
+ * and the one that leaves it, and recalculated once per window to avoid the accumulation of rounding
+ * errors, so the cost per sample doesn't depend on N.
+ * The implementation uses ANSI C and could be compiled and run on any platform
+ *
+ * @param mov: pointer to the moving window structure
+ * @param input: input array
+ * @param output: output array (can be the same as input)
+ * @param len: length of the input and output arrays
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dsps_movsum_f32_ansi(movstat_f32_t *mov, const float *input, float *output, int len);
+esp_err_t dsps_movmean_f32_ansi(movstat_f32_t *mov, const float *input, float *output, int len);
+esp_err_t dsps_movrms_f32_ansi(movstat_f32_t *mov, const float *input, float *output, int len);
+/**@}*/
+
+/**
+ * @brief   moving window variance
+ *
+ * output[i] is the variance (population, divided by N) of the last N input samples, from the
+ * moving sums of the samples and their squares. The samples are taken relative to the mean of the
+ * window, updated each time the window is filled, so a large offset doesn't cause cancellation.
+ * The implementation uses ANSI C and could be compiled and run on any platform
+ *
+ * @param mov: pointer to the moving window structure
+ * @param input: input array
+ * @param output: output array (can be the same as input)
+ * @param len: length of the input and output arrays
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dsps_movvar_f32_ansi(movstat_f32_t *mov, const float *input, float *output, int len);
+
+/**@{*/
+/**
+ * @brief   moving window maximum and minimum
+ *
+ * output[i] is the maximum or minimum of the last N input samples. The samples that can still
+ * become the maximum (minimum) are kept in decreasing (increasing) order, so each sample is
+ * inserted and removed once: the cost per sample doesn't depend on N.
+ * The implementation uses ANSI C and could be compiled and run on any platform
+ *
+ * @param mov: pointer to the moving window structure
+ * @param input: input array
+ * @param output: output array (can be the same as input)
+ * @param len: length of the input and output arrays
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dsps_movmax_f32_ansi(movstat_f32_t *mov, const float *input, float *output, int len);
+esp_err_t dsps_movmin_f32_ansi(movstat_f32_t *mov, const float *input, float *output, int len);
+/**@}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#ifdef CONFIG_DSP_OPTIMIZED
+#define dsps_movsum_f32 dsps_movsum_f32_ansi
+#define dsps_movmean_f32 dsps_movmean_f32_ansi
+#define dsps_movrms_f32 dsps_movrms_f32_ansi
+#define dsps_movvar_f32 dsps_movvar_f32_ansi
+#define dsps_movmax_f32 dsps_movmax_f32_ansi
+#define dsps_movmin_f32 dsps_movmin_f32_ansi
+#else
+#define dsps_movsum_f32 dsps_movsum_f32_ansi
+#define dsps_movmean_f32 dsps_movmean_f32_ansi
+#define dsps_movrms_f32 dsps_movrms_f32_ansi
+#define dsps_movvar_f32 dsps_movvar_f32_ansi
+#define dsps_movmax_f32 dsps_movmax_f32_ansi
+#define dsps_movmin_f32 dsps_movmin_f32_ansi
+#endif
+
+#endif // _dsps_movstat_H_
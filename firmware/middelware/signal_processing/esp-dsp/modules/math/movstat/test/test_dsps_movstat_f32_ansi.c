@@ -0,0 +1,127 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string.h>
+#include <math.h>
+#include "unity.h"
+#include "dsp_platform.h"
+#include "esp_log.h"
+
+#include "dsp_common.h"
+#include "dsps_movstat.h"
+#include "dsp_tests.h"
+
+static const char *TAG = "dsps_movstat";
+
+#define LEN 2048
+
+static float x[LEN];
+static float y[LEN];
+
+typedef esp_err_t (*movstat_func_t)(movstat_f32_t *mov, const float *input, float *output, int len);
+
+// Statistic of x[first..last] calculated directly
+static double reference(int func, int first, int last)
+{
+    double acc = 0, acc2 = 0, max = x[first], min = x[first];
+    int n = last - first + 1;
+    for (int i = first ; i <= last ; i++) {
+        acc += x[i];
+        acc2 += (double)x[i] * x[i];
+        max = (x[i] > max) ? x[i] : max;
+        min = (x[i] < min) ? x[i] : min;
+    }
+    switch (func) {
+    case 0: return acc;
+    case 1: return acc / n;
+    case 2: return sqrt(acc2 / n);
+    case 3: return acc2 / n - (acc / n) * (acc / n);
+    case 4: return max;
+    default: return min;
+    }
+}
+
+TEST_CASE("dsps_movstat_f32_ansi functionality", "[dsps]")
+{
+    const movstat_func_t funcs[] = {dsps_movsum_f32_ansi, dsps_movmean_f32_ansi, dsps_movrms_f32_ansi,
+                                    dsps_movvar_f32_ansi, dsps_movmax_f32_ansi, dsps_movmin_f32_ansi
+                                   };
+    const int windows[] = {1, 2, 7, 64, 100};
+    movstat_f32_t mov;
+    // Signal with an offset, a slow trend and steps, like an ADC frame
+    for (int i = 0 ; i < LEN ; i++) {
+        x[i] = 1000 + 0.1 * i + ((i / 300) % 2) * 50 + ((float)rand() / RAND_MAX - 0.5) * 10;
+    }
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_INVALID_LENGTH, dsps_movstat_init_f32(&mov, NULL, 0));
+    for (int f = 0 ; f < 6 ; f++) {
+        for (int w = 0 ; w < sizeof(windows) / sizeof(windows[0]) ; w++) {
+            int N = windows[w];
+            TEST_ESP_OK(dsps_movstat_init_f32(&mov, NULL, N));
+            // Blocks of several lengths, the last ones in place
+            int chunk = 1;
+            for (int i = 0 ; i < LEN ; i += chunk) {
+                chunk = 1 + (i * 13) % 97;
+                if (i + chunk > LEN) {
+                    chunk = LEN - i;
+                }
+                if (i < LEN / 2) {
+                    TEST_ESP_OK(funcs[f](&mov, &x[i], &y[i], chunk));
+                } else {
+                    memcpy(&y[i], &x[i], chunk * sizeof(float));
+                    TEST_ESP_OK(funcs[f](&mov, &y[i], &y[i], chunk));
+                }
+            }
+            for (int i = 0 ; i < LEN ; i++) {
+                int first = (i - N + 1 < 0) ? 0 : i - N + 1;
+                double expected = reference(f, first, i);
+                // Variance has the rounding error of the squared offset (x[i] ~ 1000)
+                double tolerance = (f == 3) ? 1e-3 * expected + 1e-2 : 1e-5 * fabs(expected) * N + 1e-6;
+                TEST_ASSERT_FLOAT_WITHIN(tolerance, expected, y[i]);
+            }
+            dsps_movstat_reset_f32(&mov);
+            TEST_ESP_OK(funcs[f](&mov, x, y, 1));
+            TEST_ASSERT_FLOAT_WITHIN(1e-3, reference(f, 0, 0), y[0]);
+            TEST_ESP_OK(dsps_movstat_f32_free(&mov));
+        }
+    }
+    // User delay line
+    static float delay[16];
+    TEST_ESP_OK(dsps_movstat_init_f32(&mov, delay, 16));
+    TEST_ESP_OK(dsps_movmax_f32_ansi(&mov, x, y, LEN));
+    TEST_ASSERT_EQUAL_FLOAT(reference(4, LEN - 16, LEN - 1), y[LEN - 1]);
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_PARAM_OUTOFRANGE, dsps_movmax_f32_ansi(&mov, NULL, y, LEN));
+    dsps_movstat_f32_free(&mov);
+    TEST_ASSERT_EQUAL_PTR(NULL, mov.delay);
+}
+
+TEST_CASE("dsps_movstat_f32_ansi benchmark", "[dsps]")
+{
+    movstat_f32_t mov;
+    const movstat_func_t funcs[] = {dsps_movmean_f32_ansi, dsps_movrms_f32_ansi, dsps_movvar_f32_ansi, dsps_movmax_f32_ansi};
+    const char *names[] = {"dsps_movmean_f32_ansi", "dsps_movrms_f32_ansi", "dsps_movvar_f32_ansi", "dsps_movmax_f32_ansi"};
+    for (int i = 0 ; i < LEN ; i++) {
+        x[i] = (float)rand() / RAND_MAX;
+    }
+    for (int f = 0 ; f < 4 ; f++) {
+        for (int N = 16 ; N <= 256 ; N *= 16) {
+            TEST_ESP_OK(dsps_movstat_init_f32(&mov, NULL, N));
+            unsigned int start_b = dsp_get_cpu_cycle_count();
+            funcs[f](&mov, x, y, LEN);
+            unsigned int end_b = dsp_get_cpu_cycle_count();
+            int cycles = end_b - start_b;
+            ESP_LOGI(TAG, "%s: window %i - %i cycles/sample", names[f], N, cycles / LEN);
+            // The cost doesn't grow with the window
+            TEST_ASSERT_EXEC_IN_RANGE(1, 200 * LEN, cycles);
+            dsps_movstat_f32_free(&mov);
+        }
+    }
+}
@@ -0,0 +1,114 @@
+#ifndef CIC_DECIMATOR_H_
+#define CIC_DECIMATOR_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup CIC_Decimator CIC decimator
+ */
+
+/** \brief Decimation of oversampled ADC signals with a CIC filter and a compensation FIR filter
+ *
+ * The cascaded integrator-comb (CIC) filter reduces the sample frequency by decim using only
+ * integer additions: stages integrators run at the input frequency and stages combs at the
+ * decimated one. The integers wrap around, which gives the right result as long as the output
+ * fits in 32 bits (input_bits + stages * log2(decim) <= 32).
+ *
+ * The CIC response falls inside the pass band, so it is followed by a FIR filter (dsps_fird_f32())
+ * that compensates it up to cutoff (-6 dB point, as in DesignFir()), removes the rest of the band
+ * and decimates by fir_decim. Its
+ * coefficients also include the CIC gain (decim ^ stages), so the output is a float signal in the
+ * same units as the input (mV for AnalogInputReadContinuous() blocks).
+ *
+ * @author Peñalva Albano
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 16/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "dsps_fir.h"
+/*==================[macros]=================================================*/
+#define CIC_MAX_STAGES      6       /*!< Maximum number of integrator and comb stages */
+#define CIC_BLOCK           32      /*!< CIC output samples filtered by the FIR at once */
+#define CIC_RESPONSE_POINTS 512     /*!< Frequency points used to design the compensation filter */
+/*==================[typedef]================================================*/
+/**
+ * @brief CIC decimator instance
+ *
+ * All fields are initialized by CicDecimatorInit().
+ */
+typedef struct {
+    uint16_t decim;                         /*!< CIC decimation factor */
+    uint8_t stages;                         /*!< Number of integrator and comb stages */
+    uint8_t fir_decim;                      /*!< FIR decimation factor */
+    uint16_t count;                         /*!< Input samples since the last CIC output */
+    uint32_t integrator[CIC_MAX_STAGES];    /*!< Integrators */
+    uint32_t comb[CIC_MAX_STAGES];          /*!< Previous input of each comb */
+    float *coeffs;                          /*!< Compensation FIR filter coefficients */
+    float *delay;                           /*!< Compensation FIR filter delay line */
+    fir_f32_t fir;                          /*!< Compensation FIR filter */
+    float *buffer;                          /*!< CIC output waiting for the FIR filter */
+    uint16_t buffer_lenght;                 /*!< Size of buffer (multiple of fir_decim) */
+    uint16_t buffered;                      /*!< Samples in buffer */
+} cic_decimator_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a CIC decimator
+ *
+ * The output sample frequency is sample_frec / (decim * fir_decim).
+ *
+ * @param cic               Pointer to decimator instance
+ * @param sample_frec       Input sample frequency
+ * @param decim             CIC decimation factor
+ * @param stages            Number of integrator and comb stages (from 1 to CIC_MAX_STAGES)
+ * @param input_bits        Bits of the input samples (12 for mV from the ADC)
+ * @param fir_decim         FIR decimation factor (usually 2)
+ * @param fir_taps          Taps of the compensation filter (a multiple of 4 on the ESP32-S3, see dsps_fird_init_f32())
+ * @param cutoff            Cut-off frequency of the compensation filter (usually half the output sample frequency,
+ *                          less than sample_frec / (2 * decim))
+ * @return true             Decimator initialized
+ * @return false            Invalid parameters (also the ones dsps_fird_init_f32() rejects) or not enough memory
+ */
+bool CicDecimatorInit(cic_decimator_t *cic, float sample_frec, uint16_t decim, uint8_t stages, uint8_t input_bits,
+    uint8_t fir_decim, uint16_t fir_taps, float cutoff);
+
+/**
+ * @brief Free the memory used by a decimator instance
+ *
+ * @param cic               Pointer to decimator instance
+ */
+void CicDecimatorDeinit(cic_decimator_t *cic);
+
+/**
+ * @brief Clear the state of a decimator instance
+ *
+ * @param cic               Pointer to decimator instance
+ */
+void CicDecimatorReset(cic_decimator_t *cic);
+
+/**
+ * @brief Decimate the next samples of a signal
+ *
+ * @param cic               Pointer to decimator instance
+ * @param input_signal      Input signal array (for example a block from AnalogInputReadContinuous())
+ * @param output_signal     Output signal array (of lenght = signal_lenght / (decim * fir_decim) + 1)
+ * @param signal_lenght     Number of input samples
+ * @return uint16_t         Number of output samples
+ */
+uint16_t CicDecimatorProcess(cic_decimator_t *cic, const uint16_t *input_signal, float *output_signal, uint16_t signal_lenght);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* CIC_DECIMATOR_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,94 @@
+#ifndef CONVOLUTION_H_
+#define CONVOLUTION_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Convolution Convolution and correlation
+ */
+
+/** \brief Convolution and correlation with a fixed kernel, calculated with FFT for long kernels
+ *
+ * The kernel (or pattern) is given once and its spectrum is calculated at initialization,
+ * so the cost of each signal is only the FFT of its blocks (overlap-save method).
+ * Kernels shorter than CONV_FFT_THRESHOLD are calculated in direct form (dsps_conv_f32() /
+ * dsps_corr_f32()), with the same result.
+ *
+ * @author Peñalva Albano
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 16/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "fft.h"
+/*==================[macros]=================================================*/
+#define CONV_FFT_THRESHOLD      32      /*!< Kernels of this lenght or longer use the FFT form */
+/*==================[typedef]================================================*/
+/**
+ * @brief Operation calculated
+ */
+typedef enum {
+    CONV_CONVOLUTION = 0,   /*!< Full convolution (signal_lenght + kernel_lenght - 1 outputs), as dsps_conv_f32() */
+    CONV_CORRELATION,       /*!< Correlation with pattern (signal_lenght - kernel_lenght + 1 outputs), as dsps_corr_f32() */
+} conv_mode_t;
+
+/**
+ * @brief Convolution instance
+ *
+ * All fields are initialized by ConvolutionInit().
+ */
+typedef struct {
+    conv_mode_t mode;           /*!< Convolution or correlation */
+    uint16_t kernel_lenght;     /*!< Kernel lenght */
+    float *kernel;              /*!< Copy of the kernel (direct form) or its spectrum (of lenght = fft_lenght) */
+    uint16_t fft_lenght;        /*!< FFT lenght of each block, 0 for direct form */
+    float *block;               /*!< Block being calculated (of lenght = fft_lenght) */
+    fft_plan_t plan;            /*!< FFT plan of fft_lenght points */
+} convolution_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a convolution instance
+ *
+ * @param conv              Pointer to convolution instance
+ * @param kernel            Array with the kernel or pattern (of lenght = kernel_lenght)
+ * @param kernel_lenght     Kernel lenght
+ * @param mode              Convolution or correlation
+ * @return true             Convolution initialized
+ * @return false            Invalid parameters or not enough memory
+ */
+bool ConvolutionInit(convolution_t *conv, const float *kernel, uint16_t kernel_lenght, conv_mode_t mode);
+
+/**
+ * @brief Free the memory used by a convolution instance
+ *
+ * @param conv              Pointer to convolution instance
+ */
+void ConvolutionDeinit(convolution_t *conv);
+
+/**
+ * @brief Calculate the convolution or correlation of a signal with the kernel
+ *
+ * @param conv              Pointer to convolution instance
+ * @param signal            Array with signal values (of lenght = signal_lenght)
+ * @param signal_lenght     Lenght of signal array (for correlation, at least kernel_lenght)
+ * @param output            Array to store the result (see conv_mode_t for its lenght), different from signal
+ * @return true             Result calculated
+ * @return false            Signal shorter than the pattern
+ */
+bool ConvolutionProcess(convolution_t *conv, const float *signal, uint32_t signal_lenght, float *output);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* CONVOLUTION_H_ */
+
+/*==================[end of file]============================================*/
@@ -16,15 +16,69 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 15/03/2024 | Document creation		                         						|
+ * | 16/10/2026 | Real input FFT computed with a half lenght complex FFT					|
+ * | 16/10/2026 | Selectable window, the last ones used are kept							|
+ * | 16/10/2026 | Power and dB outputs, single precision magnitude calculation			|
+ * | 16/10/2026 | FFT plans, for several signal lenghts used at the same time			|
+ * | 16/10/2026 | Selectable radix 2 or radix 4 FFT algorithm							|
+ * | 16/10/2026 | Complex spectrum and inverse FFT										|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include <stdint.h>
 #include <stdbool.h>
+#include "dsps_fft2r.h"
 /*==================[macros]=================================================*/
 #define MAX_SIGNAL_LENGHT   2048
+#define FFT_WINDOW_CACHE_SIZE   4   /*!< Windows (type and lenght) kept by FFTSpectrum() */
 /*==================[typedef]================================================*/
+/**
+ * @brief Windows available for the FFT calculation
+ */
+typedef enum {
+    FFT_HANN = 0,           /*!< Hann window (default) */
+    FFT_BLACKMAN,           /*!< Blackman window */
+    FFT_BLACKMAN_HARRIS,    /*!< Blackman-Harris window */
+    FFT_BLACKMAN_NUTTALL,   /*!< Blackman-Nuttall window */
+    FFT_NUTTALL,            /*!< Nuttall window */
+    FFT_FLAT_TOP,           /*!< Flat-top window (best amplitude accuracy, widest main lobe) */
+    FFT_RECTANGULAR,        /*!< No window (plans with this window don't store it) */
+} fft_window_t;
+
+/**
+ * @brief Output of the FFT calculation
+ */
+typedef enum {
+    FFT_MAGNITUDE = 0,      /*!< Magnitude (same units as the signal) */
+    FFT_POWER,              /*!< Power (magnitude squared, no square root is calculated) */
+    FFT_DB,                 /*!< Power in dB (20 * log10(magnitude)) */
+} fft_output_t;
+
+/**
+ * @brief Algorithm used for the complex FFT (both give the same result)
+ */
+typedef enum {
+    FFT_RADIX_2 = 0,        /*!< Radix 2 (default on targets with an assembly implementation, i.e. ESP32 and ESP32-S3) */
+    FFT_RADIX_4,            /*!< Radix 4 butterflies, about 40 % less cycles in C (default on the other targets, i.e. ESP32-C6) */
+} fft_algorithm_t;
+
+/**
+ * @brief FFT of a fixed lenght and window
+ *
+ * Each plan has its own window and buffer, so spectra of different lenghts (i.e. 256 points
+ * respiration and 2048 points ECG) can be calculated alternately without generating the window
+ * again. Twiddle and bit reverse tables are shared by all the plans of the same lenght.
+ * All fields are initialized by FFTPlanInit().
+ */
+typedef struct {
+    uint16_t lenght;                /*!< Signal lenght */
+    fft_window_t window;            /*!< Window applied to the signal */
+    float *wind;                    /*!< Window values (of lenght = lenght, NULL for FFT_RECTANGULAR) */
+    float *data;                    /*!< Signal packed as lenght / 2 complex values */
+    float *real_w;                  /*!< cos/sin table for the real FFT post-processing */
+    dsps_fft2r_plan_fc32_t fft;     /*!< Complex FFT of lenght / 2 points */
+} fft_plan_t;
 
 /*==================[external data declaration]==============================*/
 
@@ -48,6 +102,144 @@ bool FFTInit(void);
  */
 void FFTMagnitude(float * signal, float * fft, uint16_t signal_lenght);
 
+/**
+ * @brief Calculates the Fast Fourier Transform of a given signal with the selected window
+ * 
+ * The last FFT_WINDOW_CACHE_SIZE windows used (type and lenght) are kept, so callers that
+ * alternate between them don't generate the window again. The cache is not protected: spectra
+ * must be requested from a single task (FFT plans can be used from several tasks).
+ * All windows are scaled to give the same magnitude for a tone as the Hann window.
+ * 
+ * @note  Lenght of signal array must be a power of two (with maximun value = MAX_SIGNAL_LENGHT)
+ * 
+ * @param signal            Array with signal values (of lenght = signal_lenght)
+ * @param fft               Array to store FFT magnitude values (of lenght = signal_lenght / 2)
+ * @param signal_lenght     Lenght of signal arrays
+ * @param window            Window applied to the signal
+ */
+void FFTMagnitudeWindow(float * signal, float * fft, uint16_t signal_lenght, fft_window_t window);
+
+/**
+ * @brief Calculates the spectrum of a given signal with the selected window and output
+ * 
+ * @note  Lenght of signal array must be a power of two (with maximun value = MAX_SIGNAL_LENGHT)
+ * 
+ * @param signal            Array with signal values (of lenght = signal_lenght)
+ * @param fft               Array to store the spectrum (of lenght = signal_lenght / 2)
+ * @param signal_lenght     Lenght of signal arrays
+ * @param window            Window applied to the signal
+ * @param output            Magnitude, power or dB
+ */
+void FFTSpectrum(float * signal, float * fft, uint16_t signal_lenght, fft_window_t window, fft_output_t output);
+
+/**
+ * @brief Initialize a FFT plan (FFTInit() is not needed to use plans)
+ * 
+ * @note  Plans of the same lenght share their tables with a reference count that is not
+ *        protected: FFTPlanInit() and FFTPlanDeinit() must be called from a single task.
+ * 
+ * @param plan              Pointer to plan instance
+ * @param signal_lenght     Lenght of signal arrays (power of two, not limited by MAX_SIGNAL_LENGHT)
+ * @param window            Window applied to the signal
+ * @return true             Plan initialized
+ * @return false            Invalid lenght or not enough memory
+ */
+bool FFTPlanInit(fft_plan_t * plan, uint16_t signal_lenght, fft_window_t window);
+
+/**
+ * @brief Free the memory used by a FFT plan
+ * 
+ * @param plan              Pointer to plan instance
+ */
+void FFTPlanDeinit(fft_plan_t * plan);
+
+/**
+ * @brief Calculates the spectrum of a given signal with the lenght and window of a plan
+ * 
+ * Same result as FFTSpectrum() with the plan's lenght and window.
+ * 
+ * @param plan              Pointer to plan instance
+ * @param signal            Array with signal values (of lenght = plan lenght)
+ * @param fft               Array to store the spectrum (of lenght = plan lenght / 2)
+ * @param output            Magnitude, power or dB
+ */
+void FFTPlanSpectrum(fft_plan_t * plan, const float * signal, float * fft, fft_output_t output);
+
+/**
+ * @brief Calculates the complex spectrum of a real signal (no window is applied)
+ * 
+ * The spectrum is stored as Re[0], Re[signal_lenght / 2], Re[1], Im[1], ... Re[signal_lenght / 2 - 1],
+ * Im[signal_lenght / 2 - 1] (bin 0 and Nyquist bin are real), without scaling (DFT definition).
+ * 
+ * @note  Lenght of signal array must be a power of two (with maximun value = MAX_SIGNAL_LENGHT)
+ * 
+ * @param signal            Array with signal values (of lenght = signal_lenght)
+ * @param spectrum          Array to store the spectrum (of lenght = signal_lenght, can be the same as signal)
+ * @param signal_lenght     Lenght of signal array
+ */
+void FFTForward(const float * signal, float * spectrum, uint16_t signal_lenght);
+
+/**
+ * @brief Calculates the real signal of a complex spectrum (inverse of FFTForward())
+ * 
+ * @note  Lenght of signal array must be a power of two (with maximun value = MAX_SIGNAL_LENGHT)
+ * 
+ * @param spectrum          Array with the spectrum, as stored by FFTForward() (of lenght = signal_lenght)
+ * @param signal            Array to store signal values (of lenght = signal_lenght, can be the same as spectrum)
+ * @param signal_lenght     Lenght of signal array
+ */
+void FFTInverse(const float * spectrum, float * signal, uint16_t signal_lenght);
+
+/**
+ * @brief Same as FFTForward() with the lenght of a plan (the plan's window is not applied)
+ * 
+ * @param plan              Pointer to plan instance
+ * @param signal            Array with signal values (of lenght = plan lenght)
+ * @param spectrum          Array to store the spectrum (of lenght = plan lenght, can be the same as signal)
+ */
+void FFTPlanForward(fft_plan_t * plan, const float * signal, float * spectrum);
+
+/**
+ * @brief Same as FFTInverse() with the lenght of a plan
+ * 
+ * @param plan              Pointer to plan instance
+ * @param spectrum          Array with the spectrum (of lenght = plan lenght)
+ * @param signal            Array to store signal values (of lenght = plan lenght, can be the same as spectrum)
+ */
+void FFTPlanInverse(fft_plan_t * plan, const float * spectrum, float * signal);
+
+/**
+ * @brief Multiply two spectra stored as in FFTForward() (convolution of the signals)
+ * 
+ * @param spectrum_a        Array with the first spectrum (of lenght = signal_lenght)
+ * @param spectrum_b        Array with the second spectrum (of lenght = signal_lenght)
+ * @param product           Array to store the product (of lenght = signal_lenght, can be the same as any input)
+ * @param signal_lenght     Lenght of the signals
+ */
+void FFTSpectrumMultiply(const float * spectrum_a, const float * spectrum_b, float * product, uint16_t signal_lenght);
+
+/**
+ * @brief Multiply two spectra stored as in FFTForward() and add the product to a third one
+ * 
+ * @param spectrum_a        Array with the first spectrum (of lenght = signal_lenght)
+ * @param spectrum_b        Array with the second spectrum (of lenght = signal_lenght)
+ * @param accumulator       Array with the spectrum where the product is added (of lenght = signal_lenght)
+ * @param signal_lenght     Lenght of the signals
+ */
+void FFTSpectrumMultiplyAdd(const float * spectrum_a, const float * spectrum_b, float * accumulator, uint16_t signal_lenght);
+
+/**
+ * @brief Free all the windows kept by FFTSpectrum()
+ */
+void FFTWindowCacheClear(void);
+
+/**
+ * @brief Select the algorithm used by FFTMagnitude(), FFTSpectrum() and FFTPlanSpectrum()
+ * 
+ * @param fft_algorithm     Radix 2 or radix 4
+ */
+void FFTSetAlgorithm(fft_algorithm_t fft_algorithm);
+
 /**
  * @brief Return the FFT frequency axis vector
  * 
@@ -0,0 +1,68 @@
+#ifndef FFT_FIXED_H_
+#define FFT_FIXED_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup FFT_Fixed Fixed point Fast Fourier Transform
+ */
+
+/** \brief Spectrum of ADC blocks calculated with 16 bit integers
+ *
+ * The 12 bit ADC counts are centered at mid scale, windowed and transformed with a
+ * block floating point 16 bit FFT (the data is only scaled when it could overflow).
+ * Only the magnitude is converted to float, with the same scale as FFTMagnitudeWindow().
+ *
+ * Uses about half the RAM of the float FFT module (and none of it if only this module
+ * is linked), so 2048 points spectra can be calculated for several channels.
+ *
+ * @author Peñalva Albano
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 16/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "fft.h"
+/*==================[macros]=================================================*/
+#define FFT_FIXED_ADC_BITS      12      /*!< Resolution of the input samples */
+/*==================[typedef]================================================*/
+
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize the fixed point FFT calculation module
+ *
+ * @return true     FFT initialized
+ * @return false    Not possible to initialize FFT
+ */
+bool FFTFixedInit(void);
+
+/**
+ * @brief Calculates the magnitude of the Fast Fourier Transform of a block of ADC counts
+ *
+ * The signal is centered at mid scale (2^(FFT_FIXED_ADC_BITS - 1)) before the FFT, so bin 0
+ * is the mean value referred to mid scale.
+ *
+ * @note  Lenght of signal array must be a power of two (with maximun value = MAX_SIGNAL_LENGHT)
+ *
+ * @param signal            Array with ADC counts (of lenght = signal_lenght)
+ * @param fft               Array to store FFT magnitude values in ADC counts (of lenght = signal_lenght / 2)
+ * @param signal_lenght     Lenght of signal arrays
+ * @param window            Window applied to the signal
+ */
+void FFTFixedMagnitude(const uint16_t * signal, float * fft, uint16_t signal_lenght, fft_window_t window);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* FFT_FIXED_H_ */
+
+/*==================[end of file]============================================*/
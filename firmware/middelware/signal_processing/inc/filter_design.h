@@ -0,0 +1,154 @@
+#ifndef FILTER_DESIGN_H_
+#define FILTER_DESIGN_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Filter_Design Filter Design
+ */
+
+/** \brief Calculation of FIR and IIR filter coefficients at runtime
+ *
+ * IIR filters are designed from the analog prototype (Butterworth, Chebyshev type I or Bessel, this
+ * one up to DESIGN_MAX_IIR_ORDER) of any order, and returned as second order sections in the format of
+ * iir_filter_t and dsps_biquad_sos_f32() (b0, b1, b2, a1, a2). FIR filters are windowed sinc,
+ * with Hamming, Hann, Blackman or Kaiser window, in the format of dsps_fir_f32() and FirFilterInit().
+ *
+ * The last DESIGN_CACHE_SIZE designs are kept, so requesting again a filter (for example when a
+ * cut-off frequency is changed back and forth from a command) only copies its coefficients.
+ * The cache is not protected: designs must be requested from a single task. This includes the
+ * functions that design their filters with this module: IirFilterInit(), LowPassInit(), HiPassInit()
+ * and QrsDetectorInit().
+ *
+ * @author Peñalva Albano
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 16/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define DESIGN_MAX_IIR_ORDER    16      /*!< Maximum order of the Bessel prototype */
+#define DESIGN_CACHE_SIZE       8       /*!< Number of designs kept */
+/*==================[typedef]================================================*/
+/**
+ * @brief Frequency response of the designed filter
+ */
+typedef enum {
+    DESIGN_LOW_PASS = 0,    /*!< Low pass, cut-off frequency frec_1 */
+    DESIGN_HIGH_PASS,       /*!< High pass, cut-off frequency frec_1 */
+    DESIGN_BAND_PASS,       /*!< Band pass between frec_1 and frec_2 */
+    DESIGN_BAND_STOP,       /*!< Band stop between frec_1 and frec_2 (order 1 is a notch) */
+} design_band_t;
+
+/**
+ * @brief IIR analog prototypes
+ */
+typedef enum {
+    DESIGN_BUTTERWORTH = 0, /*!< Maximally flat, -3 dB at the cut-off frequency */
+    DESIGN_CHEBYSHEV,       /*!< Chebyshev type I, ripple dB in the pass band, -ripple dB at the cut-off frequency */
+    DESIGN_BESSEL,          /*!< Maximally flat group delay, -3 dB at the cut-off frequency */
+} design_iir_t;
+
+/**
+ * @brief FIR windows
+ */
+typedef enum {
+    DESIGN_HAMMING = 0,     /*!< Hamming window (about 53 dB of attenuation) */
+    DESIGN_HANN,            /*!< Hann window (about 44 dB of attenuation) */
+    DESIGN_BLACKMAN,        /*!< Blackman window (about 74 dB of attenuation) */
+    DESIGN_KAISER,          /*!< Kaiser window, attenuation given by beta (see DesignKaiserBeta()) */
+} design_window_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Number of second order sections of an IIR design
+ *
+ * Low and high pass filters use order / 2 sections (rounded up, the last one is of first order for
+ * odd orders). Band pass filters are a high pass at frec_1 followed by a low pass at frec_2, so they
+ * use twice as many. Band stop filters are the low pass to band stop transform of the prototype, each
+ * of its poles gives a section, so they use order sections.
+ *
+ * @param band              Frequency response
+ * @param order             Filter order (of the prototype)
+ * @return uint8_t          Number of sections (of IIR_SOS_COEFFS coefficients each), 0 if more than 255
+ */
+uint8_t DesignIirSections(design_band_t band, uint8_t order);
+
+/**
+ * @brief Design an IIR filter
+ *
+ * @note  The design cache is not protected: must be called from a single task.
+ *
+ * @param coeffs            Array to store the coefficients (of lenght = DesignIirSections() * IIR_SOS_COEFFS)
+ * @param type              Analog prototype
+ * @param band              Frequency response
+ * @param sample_frec       Signal's sample frequency
+ * @param frec_1            Cut-off frequency, or lower band edge
+ * @param frec_2            Upper band edge (only for band pass and band stop)
+ * @param order             Filter order of the prototype (from 1, up to DESIGN_MAX_IIR_ORDER for Bessel)
+ * @param ripple            Pass band ripple in dB (only for Chebyshev)
+ * @return true             Filter designed
+ * @return false            Invalid parameters
+ */
+bool DesignIir(float *coeffs, design_iir_t type, design_band_t band, float sample_frec, float frec_1, float frec_2, uint8_t order, float ripple);
+
+/**
+ * @brief Kaiser window beta for a stop band attenuation
+ *
+ * @param attenuation       Stop band attenuation in dB
+ * @return float            Beta parameter of the Kaiser window
+ */
+float DesignKaiserBeta(float attenuation);
+
+/**
+ * @brief Number of taps of a Kaiser window FIR filter
+ *
+ * @param sample_frec       Signal's sample frequency
+ * @param transition        Width of the transition band (in the same units as sample_frec)
+ * @param attenuation       Stop band attenuation in dB
+ * @return uint16_t         Number of taps (odd, so it can be used for any response)
+ */
+uint16_t DesignKaiserTaps(float sample_frec, float transition, float attenuation);
+
+/**
+ * @brief Design a windowed sinc FIR filter
+ *
+ * The gain is normalized to 1 at 0 Hz (low pass and band stop), at sample_frec / 2 (high pass)
+ * or at the center of the band (band pass).
+ *
+ * @note  The design cache is not protected: must be called from a single task.
+ *
+ * @param coeffs            Array to store the coefficients (of lenght = taps)
+ * @param taps              Number of taps (odd for high pass and band stop)
+ * @param window            Window applied to the ideal response
+ * @param beta              Kaiser window beta (only for DESIGN_KAISER)
+ * @param band              Frequency response
+ * @param sample_frec       Signal's sample frequency
+ * @param frec_1            Cut-off frequency, or lower band edge
+ * @param frec_2            Upper band edge (only for band pass and band stop)
+ * @return true             Filter designed
+ * @return false            Invalid parameters, or no gain left to normalize (i.e. 2 taps with Hann or Blackman window)
+ */
+bool DesignFir(float *coeffs, uint16_t taps, design_window_t window, float beta, design_band_t band, float sample_frec, float frec_1, float frec_2);
+
+/**
+ * @brief Free all the designs kept in the cache
+ *
+ * @note  The design cache is not protected: must be called from the same task as the designs.
+ */
+void DesignCacheClear(void);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* FILTER_DESIGN_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,98 @@
+#ifndef FIR_FILTER_H_
+#define FIR_FILTER_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup FIR_Filter FIR Filter
+ */
+
+/** \brief Streaming FIR filter, calculated with partitioned FFT convolution for long filters
+ *
+ * Same coefficients and result as dsps_fir_f32(), signals can be processed in blocks of any lenght.
+ * Filters shorter than FIR_FFT_THRESHOLD taps are calculated in direct form with dsps_fir_f32().
+ * Longer filters are split in partitions of block taps: the first one is calculated in direct
+ * form, so there is no extra latency, and the others with the FFT of the input blocks, whose
+ * spectra are kept to be reused by all the partitions (uniformly partitioned convolution).
+ *
+ * @author Peñalva Albano
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 16/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "dsps_fir.h"
+#include "fft.h"
+/*==================[macros]=================================================*/
+#define FIR_FFT_THRESHOLD       64      /*!< Filters of this number of taps or more use the FFT form */
+/*==================[typedef]================================================*/
+/**
+ * @brief FIR filter instance
+ *
+ * All fields are initialized by FirFilterInit().
+ */
+typedef struct {
+    uint16_t coeffs_lenght;     /*!< Number of taps */
+    uint16_t block;             /*!< Taps per partition and samples per input block, 0 for direct form */
+    uint16_t n_parts;           /*!< Partitions calculated with FFT */
+    uint16_t pos;               /*!< Samples of the current input block */
+    uint16_t newest;            /*!< Position of the newest spectrum in spectra */
+    float *coeffs;              /*!< Copy of the direct form coefficients (all of them or the first partition) */
+    fir_f32_t direct;           /*!< Direct form filter */
+    float *frame;               /*!< Previous and current input blocks (2 * block) */
+    float *tail;                /*!< Output of the FFT partitions for the current block (block) */
+    float *parts;               /*!< Spectra of the FFT partitions (n_parts * 2 * block) */
+    float *spectra;             /*!< Spectra of the last n_parts input frames (n_parts * 2 * block) */
+    fft_plan_t plan;            /*!< FFT plan of 2 * block points */
+} fir_filter_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a FIR filter instance
+ *
+ * @param filter            Pointer to filter instance
+ * @param coeffs            Array with the coefficients, in the order used by dsps_fir_init_f32() (of lenght = coeffs_lenght)
+ * @param coeffs_lenght     Number of taps
+ * @return true             Filter initialized
+ * @return false            Invalid parameters or not enough memory
+ */
+bool FirFilterInit(fir_filter_t *filter, const float *coeffs, uint16_t coeffs_lenght);
+
+/**
+ * @brief Free the memory used by a filter instance
+ *
+ * @param filter            Pointer to filter instance
+ */
+void FirFilterDeinit(fir_filter_t *filter);
+
+/**
+ * @brief Clear the delay line of a filter instance
+ *
+ * @param filter            Pointer to filter instance
+ */
+void FirFilterReset(fir_filter_t *filter);
+
+/**
+ * @brief Filter the next samples of a signal
+ *
+ * @param filter            Pointer to filter instance
+ * @param input_signal      Input signal array
+ * @param output_signal     Filtered signal array (can be the same as input_signal)
+ * @param signal_lenght     Number of samples of both signals
+ */
+void FirFilterProcess(fir_filter_t *filter, const float * input_signal, float * output_signal, uint16_t signal_lenght);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* FIR_FILTER_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,108 @@
+#ifndef GOERTZEL_H_
+#define GOERTZEL_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Goertzel Goertzel detector
+ */
+
+/** \brief Magnitude of a few frequencies using the Goertzel algorithm
+ *
+ * When only some frequencies are needed (mains detection, SSVEP stimulus, etc.) the
+ * Goertzel algorithm calculates each of them with one multiplication and two additions
+ * per sample, without storing the signal. Samples are pushed in chunks of any size and
+ * the magnitude of all the frequencies is updated every lenght samples.
+ *
+ * Frequencies don't need to match a FFT bin. Magnitude has the same units as the signal
+ * (a tone of amplitude A at one of the frequencies gives A). No window is applied.
+ *
+ * @author Peñalva Albano
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 16/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Goertzel detector instance
+ *
+ * All fields are initialized by GoertzelInit().
+ */
+typedef struct {
+    uint8_t n_freqs;                            /*!< Number of frequencies */
+    uint16_t lenght;                            /*!< Samples per block */
+    uint16_t count;                             /*!< Samples already processed in the current block */
+    float *coeff;                               /*!< 2 * cos(2 * pi * f / fs) of each frequency */
+    float *state;                               /*!< s[n-1] and s[n-2] of each frequency (2 * n_freqs) */
+    float *magnitude;                           /*!< Magnitude of each frequency in the last block */
+    uint32_t blocks;                            /*!< Blocks completed since GoertzelInit() or GoertzelReset() */
+    void (*func_p)(float *magnitude, void *param_p);/*!< Function called at the end of each block (can be NULL) */
+    void *param_p;                              /*!< Parameter passed to func_p */
+} goertzel_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a Goertzel detector
+ *
+ * @param goertzel      Pointer to detector instance
+ * @param sample_frec   Signal's sample frequency
+ * @param freqs         Array with the frequencies to detect (of lenght = n_freqs)
+ * @param n_freqs       Number of frequencies
+ * @param lenght        Samples per block (frequency resolution = sample_frec / lenght)
+ * @param func_p        Function called with the magnitudes at the end of each block, NULL to poll with GoertzelMagnitude()
+ * @param param_p       Parameter passed to func_p
+ * @return true         Detector initialized
+ * @return false        Invalid parameters or not enough memory
+ */
+bool GoertzelInit(goertzel_t *goertzel, float sample_frec, const float *freqs, uint8_t n_freqs, uint16_t lenght,
+    void (*func_p)(float *magnitude, void *param_p), void *param_p);
+
+/**
+ * @brief Free the memory used by a Goertzel detector
+ *
+ * @param goertzel      Pointer to detector instance
+ */
+void GoertzelDeinit(goertzel_t *goertzel);
+
+/**
+ * @brief Discard the current block and start a new one
+ *
+ * @param goertzel      Pointer to detector instance
+ */
+void GoertzelReset(goertzel_t *goertzel);
+
+/**
+ * @brief Push new samples
+ *
+ * @param goertzel      Pointer to detector instance
+ * @param samples       Array with new samples
+ * @param n_samples     Number of samples (any value)
+ * @return Number of blocks completed
+ */
+uint16_t GoertzelProcess(goertzel_t *goertzel, const float *samples, uint32_t n_samples);
+
+/**
+ * @brief Get the magnitudes of the last completed block
+ *
+ * @param goertzel      Pointer to detector instance
+ * @return Pointer to the magnitudes (of lenght = n_freqs, in the same order as freqs)
+ */
+float * GoertzelMagnitude(goertzel_t *goertzel);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* GOERTZEL_H_ */
+
+/*==================[end of file]============================================*/
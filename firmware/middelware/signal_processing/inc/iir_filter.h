@@ -16,12 +16,19 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 15/03/2024 | Document creation		                         						|
+ * | 16/10/2026 | Multi-instance and multi-channel filters of any even order			|
+ * | 16/10/2026 | Any order, designed with filter_design, and given coefficients		|
+ * | 16/10/2026 | Zero phase (forward-backward) filtering of a block					|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include <stdint.h>
+#include <stdbool.h>
 /*==================[macros]=================================================*/
+#define IIR_SOS_COEFFS      5   /*!< Coefficients per second order section: b0, b1, b2, a1, a2 */
+#define IIR_SOS_DELAY       2   /*!< Delay line length per second order section and channel */
+#define IIR_ZERO_PHASE_MAX_PAD  64  /*!< Maximum samples added at each edge by IirFilterZeroPhase() */
 
 /*==================[typedef]================================================*/
 typedef enum filter_order {
@@ -30,12 +37,32 @@ typedef enum filter_order {
     ORDER_6 = 6,        /*!< 6th order filter */
     ORDER_8 = 8         /*!< 8th order filter */
 } filter_order_t;
+
+typedef enum filter_type {
+    IIR_LOW_PASS,       /*!< Butterworth low pass filter */
+    IIR_HI_PASS         /*!< Butterworth hi pass filter */
+} filter_type_t;
+
+/**
+ * @brief IIR filter instance
+ * 
+ * Cascade of second order sections shared by all the channels, with an independent 
+ * delay line per channel. All fields are initialized by IirFilterInit().
+ */
+typedef struct {
+    uint8_t n_sections;     /*!< Number of second order sections (order / 2) */
+    uint8_t n_channels;     /*!< Number of channels filtered with the same coefficients */
+    float *coeffs;          /*!< Coefficients (n_sections * IIR_SOS_COEFFS) */
+    float *delay;           /*!< Delay lines (n_channels * n_sections * IIR_SOS_DELAY) */
+} iir_filter_t;
 /*==================[external data declaration]==============================*/
 
 /*==================[external functions declaration]=========================*/
 /**
  * @brief Initialize a 2nd order Butterwotrh Low Pass Filter
  * 
+ * @note  Designed with DesignIir(), whose cache is not protected: must be called from a single task.
+ * 
  * @param sample_frec   Signal's sample frequency
  * @param cut_frec      Filter's cut-off frequency
  * @param order         Filter's order (2, 4, 6 or 8)
@@ -45,6 +72,8 @@ void LowPassInit(float sample_frec, float cut_frec, filter_order_t order);
 /**
  * @brief Initialize a 2nd order Butterwotrh Hi Pass Filter
  * 
+ * @note  Designed with DesignIir(), whose cache is not protected: must be called from a single task.
+ * 
  * @param sample_frec   Signal's sample frequency
  * @param cut_frec      Filter's cut-off frequency
  * @param order         Filter's order (2, 4, 6 or 8)
@@ -69,6 +98,104 @@ void LowPassFilter(float * input_signal, float * output_signal, int16_t signal_l
  */
 void HiPassFilter(float * input_signal, float * output_signal, int16_t signal_lenght);
 
+/**
+ * @brief Initialize a Butterworth filter instance
+ * 
+ * @note  Designed with DesignIir(), whose cache is not protected: must be called from a single task.
+ * 
+ * @param filter        Filter instance
+ * @param type          IIR_LOW_PASS or IIR_HI_PASS
+ * @param sample_frec   Signal's sample frequency
+ * @param cut_frec      Filter's cut-off frequency
+ * @param order         Filter's order (from 1)
+ * @param channels      Number of signals to be filtered with this instance
+ * @return true         Filter initialized
+ * @return false        Invalid order or frequencies, or not enough memory
+ */
+bool IirFilterInit(iir_filter_t *filter, filter_type_t type, float sample_frec, float cut_frec, uint8_t order, uint8_t channels);
+
+/**
+ * @brief Initialize a filter instance with the given second order sections
+ * 
+ * Coefficients are copied, for example from DesignIir() for other responses or prototypes.
+ * 
+ * @param filter        Filter instance
+ * @param coeffs        Coefficients, b0, b1, b2, a1, a2 of each section (of lenght = n_sections * IIR_SOS_COEFFS)
+ * @param n_sections    Number of second order sections
+ * @param channels      Number of signals to be filtered with this instance
+ * @return true         Filter initialized
+ * @return false        Invalid parameters or not enough memory
+ */
+bool IirFilterInitCoeffs(iir_filter_t *filter, const float *coeffs, uint8_t n_sections, uint8_t channels);
+
+/**
+ * @brief Replace the coefficients of a filter instance, keeping its delay lines
+ * 
+ * Allows changing the cut-off frequency while a signal is being filtered, without memory allocation
+ * (the output has a transient until the delay lines settle to the new coefficients).
+ * 
+ * @param filter        Filter instance
+ * @param coeffs        Coefficients, b0, b1, b2, a1, a2 of each section (of lenght = n_sections * IIR_SOS_COEFFS)
+ * @param n_sections    Number of second order sections (the same of the instance)
+ * @return true         Coefficients replaced
+ * @return false        Different number of sections
+ */
+bool IirFilterSetCoeffs(iir_filter_t *filter, const float *coeffs, uint8_t n_sections);
+
+/**
+ * @brief Free the memory used by a filter instance
+ * 
+ * @param filter        Filter instance
+ */
+void IirFilterDeinit(iir_filter_t *filter);
+
+/**
+ * @brief Clear the delay lines of all the channels of a filter instance
+ * 
+ * @param filter        Filter instance
+ */
+void IirFilterReset(iir_filter_t *filter);
+
+/**
+ * @brief Apply a filter instance to a signal array of one of its channels
+ * 
+ * @param filter            Filter instance
+ * @param channel           Channel number (from 0 to channels - 1)
+ * @param input_signal      Input signal array
+ * @param output_signal     Filtered signal array (can be the same as input_signal)
+ * @param signal_lenght     Number of samples of both signals
+ */
+void IirFilterApply(iir_filter_t *filter, uint8_t channel, float * input_signal, float * output_signal, uint16_t signal_lenght);
+
+/**
+ * @brief Apply a filter instance to all its channels, stored interleaved
+ * 
+ * Sample n of channel c is located at [n * channels + c]. All the channels are filtered in 
+ * a single pass over the arrays.
+ * 
+ * @param filter            Filter instance
+ * @param input_signal      Input signal array (of lenght = signal_lenght * channels)
+ * @param output_signal     Filtered signal array (can be the same as input_signal)
+ * @param signal_lenght     Number of samples per channel
+ */
+void IirFilterApplyInterleaved(iir_filter_t *filter, float * input_signal, float * output_signal, uint16_t signal_lenght);
+
+/**
+ * @brief Filter a block forward and backward, for zero phase distortion
+ * 
+ * The result has no delay (peaks stay in place) and the magnitude response of the filter squared.
+ * The block is extended at each edge with its odd reflection (3 * (2 * n_sections + 1) samples, up to
+ * IIR_ZERO_PHASE_MAX_PAD) and each pass starts in the steady state of its first sample, to reduce
+ * the edge transients. The block is filtered in place, the delay line of the channel is used as
+ * working memory and it is cleared at the end.
+ * 
+ * @param filter            Filter instance
+ * @param channel           Channel number (from 0 to channels - 1)
+ * @param signal            Signal array, replaced by the filtered signal
+ * @param signal_lenght     Number of samples of the signal
+ */
+void IirFilterZeroPhase(iir_filter_t *filter, uint8_t channel, float * signal, uint16_t signal_lenght);
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
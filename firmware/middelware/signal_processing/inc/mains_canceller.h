@@ -0,0 +1,122 @@
+#ifndef MAINS_CANCELLER_H_
+#define MAINS_CANCELLER_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Mains_Canceller Mains canceller
+ */
+
+/** \brief Adaptive cancellation of mains interference (50/60 Hz) in biopotential signals
+ *
+ * The interference is estimated as a weighted sum of a cosine and a sine at the mains frequency
+ * (generated with dsps_cplx_gen) and subtracted from the signal. The two weights are updated with
+ * LMS on each sample (four multiplications), which is the same as NLMS because the reference has
+ * unit power. The result is a notch whose bandwidth is set at initialization, and which follows
+ * the phase and amplitude of the interference.
+ *
+ * If the mains frequency drifts, the weights rotate at the difference between both frequencies.
+ * That rotation is measured every MAINS_TRACK_PERIOD seconds and the frequency of the reference is
+ * corrected (and its drift estimated), so the notch can stay narrow. The frequency is kept within MAINS_MAX_DEVIATION of the
+ * nominal one.
+ *
+ * @author Peñalva Albano
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 16/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "dsps_cplx_gen.h"
+/*==================[macros]=================================================*/
+#define MAINS_BLOCK             64      /*!< Reference samples generated at once */
+#define MAINS_LUT_LENGHT        1024    /*!< Sine table of the reference */
+#define MAINS_TRACK_PERIOD      0.1     /*!< Seconds between corrections of the frequency */
+#define MAINS_TRACK_GAIN        0.5     /*!< Fraction of the measured frequency error corrected each time */
+#define MAINS_DRIFT_GAIN        0.05    /*!< Fraction of the measured frequency error added to the drift each time */
+#define MAINS_MAX_DEVIATION     0.05    /*!< Maximum frequency deviation, relative to the nominal frequency */
+/*==================[typedef]================================================*/
+/**
+ * @brief Mains canceller instance
+ *
+ * All fields are initialized by MainsCancellerInit().
+ */
+typedef struct {
+    float sample_frec;          /*!< Signal's sample frequency */
+    float nominal;              /*!< Nominal mains frequency (cycles per sample) */
+    float step;                 /*!< LMS step */
+    float weights[2];           /*!< Weights of the cosine and the sine */
+    float last[2];              /*!< Weights at the last frequency correction */
+    float drift;                /*!< Change of the frequency between corrections */
+    uint16_t period;            /*!< Samples between frequency corrections */
+    uint16_t count;             /*!< Samples since the last frequency correction */
+    cplx_sig_t ref;             /*!< Reference generator */
+    float *buffer;              /*!< Reference samples (cosine and sine interleaved, 2 * MAINS_BLOCK) */
+} mains_canceller_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a mains canceller
+ *
+ * @param canceller         Pointer to canceller instance
+ * @param sample_frec       Signal's sample frequency
+ * @param mains_frec        Nominal mains frequency (50 or 60 Hz)
+ * @param bandwidth         Bandwidth of the notch (in the same units as sample_frec)
+ * @return true             Canceller initialized
+ * @return false            Invalid parameters or not enough memory
+ */
+bool MainsCancellerInit(mains_canceller_t *canceller, float sample_frec, float mains_frec, float bandwidth);
+
+/**
+ * @brief Free the memory used by a canceller instance
+ *
+ * @param canceller         Pointer to canceller instance
+ */
+void MainsCancellerDeinit(mains_canceller_t *canceller);
+
+/**
+ * @brief Clear the weights and go back to the nominal frequency
+ *
+ * @param canceller         Pointer to canceller instance
+ */
+void MainsCancellerReset(mains_canceller_t *canceller);
+
+/**
+ * @brief Remove the interference from the next samples of a signal
+ *
+ * @param canceller         Pointer to canceller instance
+ * @param input_signal      Input signal array
+ * @param output_signal     Output signal array (can be the same as input_signal)
+ * @param signal_lenght     Number of samples of both signals
+ */
+void MainsCancellerProcess(mains_canceller_t *canceller, const float * input_signal, float * output_signal, uint16_t signal_lenght);
+
+/**
+ * @brief Mains frequency being tracked
+ *
+ * @param canceller         Pointer to canceller instance
+ * @return float            Frequency (in the same units as sample_frec)
+ */
+float MainsCancellerFrequency(mains_canceller_t *canceller);
+
+/**
+ * @brief Amplitude of the interference being cancelled
+ *
+ * @param canceller         Pointer to canceller instance
+ * @return float            Amplitude (in the same units as the signal)
+ */
+float MainsCancellerAmplitude(mains_canceller_t *canceller);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* MAINS_CANCELLER_H_ */
+
+/*==================[end of file]============================================*/
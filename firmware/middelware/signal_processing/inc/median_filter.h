@@ -0,0 +1,142 @@
+#ifndef MEDIAN_FILTER_H_
+#define MEDIAN_FILTER_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Median_Filter Median filter
+ */
+
+/** \brief Streaming median filter and Hampel outlier filter
+ *
+ * Unlike averaging, the median removes isolated spikes (for example false echoes of a distance
+ * sensor) without smearing steps. The window is kept sorted: on each sample the oldest value is
+ * found with a binary search, the new one is located the same way, and only the values between
+ * both positions are moved.
+ *
+ * The Hampel filter only replaces the samples that are outliers: those further than threshold
+ * times the standard deviation (estimated as 1.4826 times the median absolute deviation) from the
+ * median of the window, which includes the new sample (there is no delay). Other samples go through
+ * unchanged. If all the window is equal, any different sample is replaced by the median.
+ *
+ * @author Peñalva Albano
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 16/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define HAMPEL_MAD_SCALE    1.4826  /*!< Standard deviation / median absolute deviation (normal distribution) */
+/*==================[typedef]================================================*/
+/**
+ * @brief Median filter instance
+ *
+ * All fields are initialized by MedianFilterInit().
+ */
+typedef struct {
+    uint16_t lenght;            /*!< Window lenght */
+    uint16_t pos;               /*!< Position of the oldest sample in window */
+    uint16_t count;             /*!< Samples in the window (less than lenght only at start) */
+    float *window;              /*!< Samples in arrival order (lenght) */
+    float *sorted;              /*!< Samples sorted (lenght) */
+} median_filter_t;
+
+/**
+ * @brief Hampel filter instance
+ *
+ * All fields are initialized by HampelFilterInit().
+ */
+typedef struct {
+    median_filter_t median;     /*!< Window of the input samples */
+    float threshold;            /*!< Outlier threshold, in standard deviations */
+    uint32_t outliers;          /*!< Samples replaced since HampelFilterInit() or HampelFilterReset() */
+} hampel_filter_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a median filter instance
+ *
+ * @param filter            Pointer to filter instance
+ * @param lenght            Window lenght (odd, so the median is one of the samples)
+ * @return true             Filter initialized
+ * @return false            Invalid parameters or not enough memory
+ */
+bool MedianFilterInit(median_filter_t *filter, uint16_t lenght);
+
+/**
+ * @brief Free the memory used by a filter instance
+ *
+ * @param filter            Pointer to filter instance
+ */
+void MedianFilterDeinit(median_filter_t *filter);
+
+/**
+ * @brief Clear the window of a filter instance
+ *
+ * @param filter            Pointer to filter instance
+ */
+void MedianFilterReset(median_filter_t *filter);
+
+/**
+ * @brief Filter the next samples of a signal
+ *
+ * Each output is the median of the last lenght input samples (of the samples received
+ * so far at start).
+ *
+ * @param filter            Pointer to filter instance
+ * @param input_signal      Input signal array
+ * @param output_signal     Filtered signal array (can be the same as input_signal)
+ * @param signal_lenght     Number of samples of both signals
+ */
+void MedianFilterProcess(median_filter_t *filter, const float * input_signal, float * output_signal, uint16_t signal_lenght);
+
+/**
+ * @brief Initialize a Hampel filter instance
+ *
+ * @param filter            Pointer to filter instance
+ * @param lenght            Window lenght (odd)
+ * @param threshold         Outlier threshold, in standard deviations (usually 3)
+ * @return true             Filter initialized
+ * @return false            Invalid parameters or not enough memory
+ */
+bool HampelFilterInit(hampel_filter_t *filter, uint16_t lenght, float threshold);
+
+/**
+ * @brief Free the memory used by a filter instance
+ *
+ * @param filter            Pointer to filter instance
+ */
+void HampelFilterDeinit(hampel_filter_t *filter);
+
+/**
+ * @brief Clear the window and the outliers count of a filter instance
+ *
+ * @param filter            Pointer to filter instance
+ */
+void HampelFilterReset(hampel_filter_t *filter);
+
+/**
+ * @brief Replace the outliers of the next samples of a signal
+ *
+ * @param filter            Pointer to filter instance
+ * @param input_signal      Input signal array
+ * @param output_signal     Filtered signal array (can be the same as input_signal)
+ * @param signal_lenght     Number of samples of both signals
+ * @return uint16_t         Number of samples replaced
+ */
+uint16_t HampelFilterProcess(hampel_filter_t *filter, const float * input_signal, float * output_signal, uint16_t signal_lenght);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* MEDIAN_FILTER_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,155 @@
+#ifndef QRS_DETECTOR_H_
+#define QRS_DETECTOR_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup QRS_Detector QRS detector
+ */
+
+/** \brief Streaming R peak detection in ECG signals (Pan-Tompkins)
+ *
+ * The signal is band pass filtered (QRS_LOW_FREC to QRS_HIGH_FREC, with iir_filter), differentiated,
+ * squared and integrated in a moving window of QRS_WINDOW seconds. Peaks of the integrated signal
+ * are compared against a threshold that adapts to the level of the last QRS and noise peaks. Peaks
+ * closer than QRS_REFRACTORY to the last beat are ignored, and peaks closer than QRS_T_WAVE are
+ * rejected as T waves if their slope is less than half of the last QRS. If no beat is found for
+ * 1.66 times the mean RR interval, the largest peak over half the threshold is taken (search back).
+ *
+ * The R peak is located on the input signal, as the largest deviation from its mean around the QRS.
+ * Beats are reported QRS_HOLD seconds after the peak, with the number of sample of the R peak (counted
+ * from QrsDetectorInit() or QrsDetectorReset()) and the heart rate from the last RR interval.
+ * Thresholds are learned during the first QRS_LEARN seconds, where no beats are detected.
+ * The signal can be in any units (thresholds are relative).
+ *
+ * @author Peñalva Albano
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 16/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "iir_filter.h"
+/*==================[macros]=================================================*/
+#define QRS_LOW_FREC        5       /*!< Low cut-off frequency of the band pass filter (Hz) */
+#define QRS_HIGH_FREC       15      /*!< High cut-off frequency of the band pass filter (Hz) */
+#define QRS_WINDOW          0.15    /*!< Moving window integration lenght (s) */
+#define QRS_HOLD            0.2     /*!< Time without a larger value to take a peak (s) */
+#define QRS_REFRACTORY      0.2     /*!< Minimum time between beats (s) */
+#define QRS_T_WAVE          0.36    /*!< Peaks closer to the last beat are checked for T waves (s) */
+#define QRS_LEARN           2       /*!< Learning time of the thresholds (s) */
+#define QRS_RR_AVERAGE      8       /*!< Number of RR intervals averaged for search back */
+#define QRS_BLOCK           64      /*!< Samples filtered at once */
+#define QRS_DERIVATIVE_LENGHT 4       /*!< Past samples used by the derivative */
+/*==================[typedef]================================================*/
+/**
+ * @brief Detected beat
+ */
+typedef struct {
+    uint32_t sample;            /*!< Sample of the R peak */
+    float heart_rate;           /*!< Heart rate from the last RR interval (bpm, 0 for the first beat) */
+} qrs_beat_t;
+
+/**
+ * @brief QRS detector instance
+ *
+ * All fields are initialized by QrsDetectorInit().
+ */
+typedef struct {
+    float sample_frec;          /*!< Signal's sample frequency */
+    iir_filter_t band_pass;     /*!< Band pass filter */
+    float *buffer;              /*!< Band pass filtered block (QRS_BLOCK) */
+    float filtered[QRS_DERIVATIVE_LENGHT];/*!< Last band pass filtered samples, for the derivative */
+    float *ring;                /*!< Last input samples (ring_lenght) */
+    uint16_t ring_lenght;       /*!< Samples kept to locate the R peaks */
+    uint16_t ring_pos;          /*!< Position of the next sample in ring */
+    float *window;              /*!< Last squared derivative samples (window_lenght) */
+    uint16_t window_lenght;     /*!< Moving window integration lenght (samples) */
+    uint16_t window_pos;        /*!< Position of the next sample in window */
+    float window_sum;           /*!< Sum of window */
+    float integrated;           /*!< Last integrated sample */
+    uint16_t delay;             /*!< Delay of the band pass filter (samples) */
+    uint16_t hold;              /*!< QRS_HOLD (samples) */
+    uint16_t refractory;        /*!< QRS_REFRACTORY (samples) */
+    uint16_t t_wave;            /*!< QRS_T_WAVE (samples) */
+    uint32_t learn;             /*!< QRS_LEARN (samples) */
+    uint32_t samples;           /*!< Samples processed */
+    float peak;                 /*!< Current peak of the integrated signal (0 if none) */
+    uint32_t peak_sample;       /*!< Sample of the current peak */
+    float signal_level;         /*!< Level of the QRS peaks (SPKI) */
+    float noise_level;          /*!< Level of the noise peaks (NPKI) */
+    float threshold;            /*!< Detection threshold */
+    float candidate;            /*!< Largest noise peak since the last beat, for search back (0 if none) */
+    uint32_t candidate_r;       /*!< Sample of the R peak of candidate */
+    float candidate_slope;      /*!< Slope of candidate */
+    uint32_t last_r;            /*!< Sample of the last R peak */
+    float last_slope;           /*!< Maximum slope of the last QRS */
+    uint32_t beats;             /*!< Beats detected */
+    uint32_t rr[QRS_RR_AVERAGE];/*!< Last RR intervals (samples) */
+    uint32_t rr_sum;            /*!< Sum of rr */
+    float heart_rate;           /*!< Heart rate of the last beat (bpm) */
+    void (*func_p)(qrs_beat_t *beat, void *param_p);/*!< Function called on each beat (can be NULL) */
+    void *param_p;              /*!< Parameter passed to func_p */
+} qrs_detector_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a QRS detector
+ *
+ * @note  The band pass filter is designed with DesignIir(), whose cache is not protected: must be
+ *        called from a single task.
+ *
+ * @param detector      Pointer to detector instance
+ * @param sample_frec   Signal's sample frequency (more than 2 * QRS_HIGH_FREC)
+ * @param func_p        Function called on each beat (can be NULL)
+ * @param param_p       Parameter passed to func_p
+ * @return true         Detector initialized
+ * @return false        Invalid parameters or not enough memory
+ */
+bool QrsDetectorInit(qrs_detector_t *detector, float sample_frec, void (*func_p)(qrs_beat_t *beat, void *param_p), void *param_p);
+
+/**
+ * @brief Free the memory used by a detector instance
+ *
+ * @param detector      Pointer to detector instance
+ */
+void QrsDetectorDeinit(qrs_detector_t *detector);
+
+/**
+ * @brief Start again (clear the filters, the thresholds and the sample count)
+ *
+ * @param detector      Pointer to detector instance
+ */
+void QrsDetectorReset(qrs_detector_t *detector);
+
+/**
+ * @brief Process the next samples of the ECG signal
+ *
+ * @param detector      Pointer to detector instance
+ * @param samples       Signal array
+ * @param n_samples     Number of samples
+ * @return uint16_t     Number of beats detected
+ */
+uint16_t QrsDetectorProcess(qrs_detector_t *detector, const float *samples, uint32_t n_samples);
+
+/**
+ * @brief Heart rate of the last beat
+ *
+ * @param detector      Pointer to detector instance
+ * @return float        Heart rate (bpm, 0 if there is none yet)
+ */
+float QrsDetectorHeartRate(qrs_detector_t *detector);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* QRS_DETECTOR_H_ */
+
+/*==================[end of file]============================================*/
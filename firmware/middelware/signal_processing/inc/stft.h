@@ -0,0 +1,110 @@
+#ifndef STFT_H_
+#define STFT_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup STFT Short-Time Fourier Transform
+ */
+
+/** \brief Streaming spectrogram calculation
+ *
+ * Samples are pushed in chunks of any size. Every time a new hop of samples is available
+ * (and at least one full frame has been received) the magnitude spectrum of the last
+ * lenght samples is calculated and passed to a callback function. The magnitude is the same
+ * as FFTMagnitudeWindow() gives, but each instance has its own FFT plan (window and buffer),
+ * so several instances and other FFT functions can be used at the same time.
+ *
+ * The last lenght samples are kept in a ring stored twice, so they are always contiguous
+ * and overlapping frames are transformed without copying the shared samples.
+ *
+ * @author Peñalva Albano
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 16/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "fft.h"
+/*==================[macros]=================================================*/
+
+/*==================[typedef]================================================*/
+/**
+ * @brief STFT instance
+ *
+ * All fields are initialized by StftInit().
+ */
+typedef struct {
+    uint16_t lenght;                            /*!< Samples per frame (FFT lenght) */
+    uint16_t hop;                               /*!< Samples between the start of consecutive frames */
+    fft_window_t window;                        /*!< Window applied to each frame */
+    fft_plan_t plan;                            /*!< FFT of lenght points with the window */
+    float *ring;                                /*!< Last lenght samples, stored twice (2 * lenght) */
+    float *frame;                               /*!< Last magnitude frame (lenght / 2) */
+    uint16_t pos;                               /*!< Position of the oldest sample in the ring */
+    uint16_t to_next;                           /*!< Samples left to complete the next frame */
+    uint32_t frames;                            /*!< Frames calculated since StftInit() or StftReset() */
+    void (*func_p)(float *frame, void *param_p);/*!< Function called with each new frame (can be NULL) */
+    void *param_p;                              /*!< Parameter passed to func_p */
+} stft_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a STFT instance
+ *
+ * @param stft          Pointer to STFT instance
+ * @param lenght        Samples per frame (power of two, see FFTPlanInit())
+ * @param hop           Samples between consecutive frames (1 to lenght, overlap = lenght - hop)
+ * @param window        Window applied to each frame
+ * @param func_p        Function called with each new frame (of lenght = lenght / 2), NULL to poll with StftFrame()
+ * @param param_p       Parameter passed to func_p
+ * @return true         STFT initialized
+ * @return false        Invalid parameters or not enough memory
+ */
+bool StftInit(stft_t *stft, uint16_t lenght, uint16_t hop, fft_window_t window, void (*func_p)(float *frame, void *param_p), void *param_p);
+
+/**
+ * @brief Free the memory used by a STFT instance
+ *
+ * @param stft          Pointer to STFT instance
+ */
+void StftDeinit(stft_t *stft);
+
+/**
+ * @brief Discard the stored samples (next frame will be calculated after lenght new samples)
+ *
+ * @param stft          Pointer to STFT instance
+ */
+void StftReset(stft_t *stft);
+
+/**
+ * @brief Push new samples and calculate all the frames completed by them
+ *
+ * @param stft          Pointer to STFT instance
+ * @param samples       Array with new samples
+ * @param n_samples     Number of samples (any value)
+ * @return Number of frames calculated
+ */
+uint16_t StftProcess(stft_t *stft, const float *samples, uint32_t n_samples);
+
+/**
+ * @brief Get the last calculated frame
+ *
+ * @param stft          Pointer to STFT instance
+ * @return Pointer to the magnitude frame (of lenght = lenght / 2)
+ */
+float * StftFrame(stft_t *stft);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* STFT_H_ */
+
+/*==================[end of file]============================================*/
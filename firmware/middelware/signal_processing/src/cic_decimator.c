@@ -0,0 +1,154 @@
+/**
+ * @file cic_decimator.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdlib.h>
+#include <malloc.h>
+#include <string.h>
+#include <math.h>
+#include "cic_decimator.h"
+#include "dsps_wind.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Magnitude of the CIC response (normalized to 1 at 0 Hz) at f cycles per decimated sample
+ */
+static float CicResponse(cic_decimator_t *cic, float f){
+    if(f < 1e-6f){
+        return 1;
+    }
+    return powf(fabsf(sinf(M_PI * f) / (cic->decim * sinf(M_PI * f / cic->decim))), cic->stages);
+}
+
+/**
+ * @brief Compensation filter by frequency sampling: the inverse of the CIC response up to cutoff
+ * (cycles per decimated sample), 0 over it, with a Blackman-Harris window
+ */
+static void CicCompensation(cic_decimator_t *cic, uint16_t taps, float cutoff){
+    float f, m, gain = 0;
+    dsps_wind_blackman_harris_f32(cic->coeffs, taps);
+    for(uint16_t i = 0; i < taps; i++){
+        m = i - (taps - 1) / 2.0f;
+        float h = 0;
+        for(uint16_t k = 0; k < CIC_RESPONSE_POINTS; k++){
+            f = (k + 0.5f) * cutoff / CIC_RESPONSE_POINTS;
+            h += cosf(2 * M_PI * f * m) / CicResponse(cic, f);
+        }
+        cic->coeffs[i] *= 2 * h * cutoff / CIC_RESPONSE_POINTS;
+        gain += cic->coeffs[i];
+    }
+    // Unit gain at 0 Hz, including the CIC gain
+    gain *= powf(cic->decim, cic->stages);
+    for(uint16_t i = 0; i < taps; i++){
+        cic->coeffs[i] /= gain;
+    }
+}
+
+/**
+ * @brief Filter the complete groups of fir_decim samples in buffer
+ */
+static uint16_t CicFlush(cic_decimator_t *cic, float *output_signal){
+    uint16_t n = cic->buffered / cic->fir_decim;
+    dsps_fird_f32(&cic->fir, cic->buffer, output_signal, n);
+    cic->buffered -= n * cic->fir_decim;
+    memmove(cic->buffer, &cic->buffer[n * cic->fir_decim], cic->buffered * sizeof(float));
+    return n;
+}
+
+/*==================[external functions definition]==========================*/
+bool CicDecimatorInit(cic_decimator_t *cic, float sample_frec, uint16_t decim, uint8_t stages, uint8_t input_bits,
+    uint8_t fir_decim, uint16_t fir_taps, float cutoff){
+    float cic_frec = sample_frec / decim;
+    if((decim == 0) || (stages == 0) || (stages > CIC_MAX_STAGES) || (fir_decim == 0) || (fir_taps == 0) ||
+        (cutoff <= 0) || (cutoff >= cic_frec / 2) ||
+        (input_bits + stages * log2f(decim) > 32)){
+        return false;
+    }
+    cic->decim = decim;
+    cic->stages = stages;
+    cic->fir_decim = fir_decim;
+    cic->buffer_lenght = fir_decim * ((CIC_BLOCK + fir_decim - 1) / fir_decim);
+    // Aligned as dsps_fird_init_f32() requires on the ESP32-S3
+    cic->coeffs = (float *)memalign(16, fir_taps * sizeof(float));
+    cic->delay = (float *)memalign(16, fir_taps * sizeof(float));
+    cic->buffer = (float *)malloc(cic->buffer_lenght * sizeof(float));
+    if((cic->coeffs == NULL) || (cic->delay == NULL) || (cic->buffer == NULL)){
+        CicDecimatorDeinit(cic);
+        return false;
+    }
+    CicCompensation(cic, fir_taps, cutoff / cic_frec);
+    if(dsps_fird_init_f32(&cic->fir, cic->coeffs, cic->delay, fir_taps, fir_decim) != ESP_OK){
+        CicDecimatorDeinit(cic);
+        return false;
+    }
+    CicDecimatorReset(cic);
+    return true;
+}
+
+void CicDecimatorDeinit(cic_decimator_t *cic){
+    free(cic->coeffs);
+    free(cic->delay);
+    free(cic->buffer);
+    cic->coeffs = NULL;
+    cic->delay = NULL;
+    cic->buffer = NULL;
+}
+
+void CicDecimatorReset(cic_decimator_t *cic){
+    memset(cic->integrator, 0, sizeof(cic->integrator));
+    memset(cic->comb, 0, sizeof(cic->comb));
+    memset(cic->delay, 0, cic->fir.N * sizeof(float));
+    cic->fir.pos = 0;
+    cic->count = 0;
+    cic->buffered = 0;
+}
+
+uint16_t CicDecimatorProcess(cic_decimator_t *cic, const uint16_t *input_signal, float *output_signal, uint16_t signal_lenght){
+    uint16_t outputs = 0;
+    uint32_t *integrator = cic->integrator;
+    uint32_t *comb = cic->comb;
+    uint32_t y, previous;
+    for(uint16_t i = 0; i < signal_lenght; i++){
+        // Integrators at the input frequency (wrapping around is fine)
+        integrator[0] += input_signal[i];
+        for(uint8_t k = 1; k < cic->stages; k++){
+            integrator[k] += integrator[k - 1];
+        }
+        if(++cic->count < cic->decim){
+            continue;
+        }
+        // Combs at the decimated frequency
+        cic->count = 0;
+        y = integrator[cic->stages - 1];
+        for(uint8_t k = 0; k < cic->stages; k++){
+            previous = y;
+            y -= comb[k];
+            comb[k] = previous;
+        }
+        cic->buffer[cic->buffered++] = y;
+        if(cic->buffered == cic->buffer_lenght){
+            outputs += CicFlush(cic, &output_signal[outputs]);
+        }
+    }
+    outputs += CicFlush(cic, &output_signal[outputs]);
+    return outputs;
+}
+
+/*==================[end of file]============================================*/
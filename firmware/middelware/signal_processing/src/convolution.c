@@ -0,0 +1,145 @@
+/**
+ * @file convolution.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdlib.h>
+#include <string.h>
+#include "convolution.h"
+#include "esp_dsp.h"
+/*==================[macros and definitions]=================================*/
+#define CONV_MAX_FFT_LENGHT     (2 * CONFIG_DSP_MAX_FFT_SIZE)   /*!< Real FFT of twice the complex FFT size */
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief FFT lenght for a kernel: 4 times the kernel rounded up to a power of two, so at least
+ * 3/4 of each block are valid outputs. 0 if the kernel is too long.
+ */
+static uint16_t FFTLenght(uint16_t kernel_lenght){
+    uint32_t lenght = 1;
+    while(lenght < kernel_lenght){
+        lenght <<= 1;
+    }
+    lenght *= 4;
+    if(lenght > CONV_MAX_FFT_LENGHT){
+        lenght = CONV_MAX_FFT_LENGHT;
+    }
+    if(lenght < 2 * kernel_lenght){
+        return 0;
+    }
+    return lenght;
+}
+/*==================[external functions definition]==========================*/
+bool ConvolutionInit(convolution_t *conv, const float *kernel, uint16_t kernel_lenght, conv_mode_t mode){
+    if(kernel_lenght == 0){
+        return false;
+    }
+    conv->mode = mode;
+    conv->kernel_lenght = kernel_lenght;
+    conv->kernel = NULL;
+    conv->block = NULL;
+    // ConvolutionDeinit() may release the plan before FFTPlanInit() is reached
+    memset(&conv->plan, 0, sizeof(conv->plan));
+    conv->fft_lenght = 0;
+    if(kernel_lenght >= CONV_FFT_THRESHOLD){
+        conv->fft_lenght = FFTLenght(kernel_lenght);
+    }
+    if(conv->fft_lenght == 0){
+        // Direct form
+        conv->kernel = (float *)malloc(kernel_lenght * sizeof(float));
+        if(conv->kernel == NULL){
+            return false;
+        }
+        memcpy(conv->kernel, kernel, kernel_lenght * sizeof(float));
+        return true;
+    }
+    conv->kernel = (float *)calloc(conv->fft_lenght, sizeof(float));
+    conv->block = (float *)malloc(conv->fft_lenght * sizeof(float));
+    if((conv->kernel == NULL) || (conv->block == NULL) ||
+        !FFTPlanInit(&conv->plan, conv->fft_lenght, FFT_RECTANGULAR)){
+        ConvolutionDeinit(conv);
+        return false;
+    }
+    // Correlation is the convolution with the reversed pattern
+    for(uint16_t i = 0; i < kernel_lenght; i++){
+        conv->kernel[i] = (mode == CONV_CORRELATION) ? kernel[kernel_lenght - 1 - i] : kernel[i];
+    }
+    FFTPlanForward(&conv->plan, conv->kernel, conv->kernel);
+    return true;
+}
+
+void ConvolutionDeinit(convolution_t *conv){
+    free(conv->kernel);
+    free(conv->block);
+    conv->kernel = NULL;
+    conv->block = NULL;
+    if(conv->fft_lenght != 0){
+        FFTPlanDeinit(&conv->plan);
+    }
+}
+
+bool ConvolutionProcess(convolution_t *conv, const float *signal, uint32_t signal_lenght, float *output){
+    uint16_t m = conv->kernel_lenght;
+    uint32_t first, count, n;
+    int32_t start, end;
+    if(conv->mode == CONV_CORRELATION){
+        if(signal_lenght < m){
+            return false;
+        }
+        first = m - 1;
+        count = signal_lenght - m + 1;
+    } else {
+        first = 0;
+        count = signal_lenght + m - 1;
+    }
+    if(conv->fft_lenght == 0){
+        if(conv->mode == CONV_CORRELATION){
+            dsps_corr_f32(signal, signal_lenght, conv->kernel, m, output);
+        } else {
+            dsps_conv_f32(signal, signal_lenght, conv->kernel, m, output);
+        }
+        return true;
+    }
+    // Overlap-save: each block of fft_lenght inputs gives fft_lenght - m + 1 outputs
+    // of the full convolution (the first m - 1 outputs of the circular one are discarded)
+    uint16_t step = conv->fft_lenght - m + 1;
+    for(uint32_t out = 0; out < count; out += step){
+        n = count - out;
+        if(n > step){
+            n = step;
+        }
+        // Inputs from first + out - (m - 1) (zero outside the signal)
+        start = (int32_t)(first + out) - (m - 1);
+        end = start + conv->fft_lenght;
+        if(end > (int32_t)signal_lenght){
+            end = signal_lenght;
+        }
+        memset(conv->block, 0, conv->fft_lenght * sizeof(float));
+        if(start < 0){
+            memcpy(&conv->block[-start], signal, end * sizeof(float));
+        } else if(end > start){
+            memcpy(conv->block, &signal[start], (end - start) * sizeof(float));
+        }
+        FFTPlanForward(&conv->plan, conv->block, conv->block);
+        FFTSpectrumMultiply(conv->block, conv->kernel, conv->block, conv->fft_lenght);
+        FFTPlanInverse(&conv->plan, conv->block, conv->block);
+        memcpy(&output[out], &conv->block[m - 1], n * sizeof(float));
+    }
+    return true;
+}
+
+/*==================[end of file]============================================*/
@@ -10,6 +10,7 @@
  */
 
 /*==================[inclusions]=============================================*/
+#include <stdlib.h>
 #include <string.h>
 #include <math.h>
 #include "fft.h"
@@ -17,9 +18,27 @@
 #include "esp_log.h"
 /*==================[macros and definitions]=================================*/
 #define TAG "FFT Module"
+#if CONFIG_DSP_OPTIMIZED && ((dsps_fft2r_fc32_ae32_enabled == 1) || (dsps_fft2r_fc32_aes3_enabled == 1))
+#define FFT_DEFAULT_ALGORITHM   FFT_RADIX_2     /*!< Radix 2 has an assembly implementation for this target */
+#else
+#define FFT_DEFAULT_ALGORITHM   FFT_RADIX_4
+#endif
+
+/**
+ * @brief Window kept in the cache
+ */
+typedef struct {
+    fft_window_t type;      /*!< Window type */
+    uint16_t lenght;        /*!< Window lenght, 0 for an empty entry */
+    float *values;          /*!< Window values */
+    uint32_t last_use;      /*!< Time of the last request, for replacement */
+} window_entry_t;
 /*==================[internal data declaration]==============================*/
-static float fft_complex[2 * MAX_SIGNAL_LENGHT];
-static float wind[MAX_SIGNAL_LENGHT];
+static float fft_complex[MAX_SIGNAL_LENGHT];                  /*!< Real signal packed as MAX_SIGNAL_LENGHT / 2 complex values */
+static window_entry_t wind_cache[FFT_WINDOW_CACHE_SIZE];      /*!< Last windows used by FFTSpectrum() */
+static uint32_t wind_time;
+static float fft_real_w[2 * (MAX_SIGNAL_LENGHT / 4 + 1)];     /*!< cos/sin table for the real FFT post-processing */
+static fft_algorithm_t algorithm = FFT_DEFAULT_ALGORITHM;
 /*==================[internal functions declaration]=========================*/
 
 /*==================[internal data definition]===============================*/
@@ -27,6 +46,160 @@ static float wind[MAX_SIGNAL_LENGHT];
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+/**
+ * @brief Generate a window scaled by 0.5 / a0 (a0: coherent gain), so a tone gives the same
+ * magnitude with all of them (Hann window is not modified)
+ */
+static void WindowGenerate(float * window_p, fft_window_t window, uint16_t signal_lenght){
+    float a0 = 0.5;
+    switch(window){
+        case FFT_HANN:
+            dsps_wind_hann_f32(window_p, signal_lenght);
+        break;
+        case FFT_BLACKMAN:
+            dsps_wind_blackman_f32(window_p, signal_lenght);
+            a0 = 0.42;
+        break;
+        case FFT_BLACKMAN_HARRIS:
+            dsps_wind_blackman_harris_f32(window_p, signal_lenght);
+            a0 = 0.35875;
+        break;
+        case FFT_BLACKMAN_NUTTALL:
+            dsps_wind_blackman_nuttall_f32(window_p, signal_lenght);
+            a0 = 0.3635819;
+        break;
+        case FFT_NUTTALL:
+            dsps_wind_nuttall_f32(window_p, signal_lenght);
+            a0 = 0.355768;
+        break;
+        case FFT_FLAT_TOP:
+            dsps_wind_flat_top_f32(window_p, signal_lenght);
+            a0 = 0.21557895;
+        break;
+        case FFT_RECTANGULAR:
+            for(uint16_t i = 0; i < signal_lenght; i++){
+                window_p[i] = 1;
+            }
+            a0 = 1;
+        break;
+    }
+    if(window != FFT_HANN){
+        dsps_mulc_f32(window_p, window_p, signal_lenght, 0.5 / a0, 1, 1);
+    }
+}
+
+/**
+ * @brief Get a window from the cache. If it is not there it is generated in an empty entry, or
+ * in place of the least recently used one
+ *
+ * @return Window values, NULL if there is not enough memory to keep it
+ */
+static const float * WindowGet(fft_window_t window, uint16_t signal_lenght){
+    window_entry_t *entry = &wind_cache[0];
+    for(uint8_t i = 0; i < FFT_WINDOW_CACHE_SIZE; i++){
+        if((wind_cache[i].lenght == signal_lenght) && (wind_cache[i].type == window)){
+            wind_cache[i].last_use = ++wind_time;
+            return wind_cache[i].values;
+        }
+    }
+    for(uint8_t i = 0; i < FFT_WINDOW_CACHE_SIZE; i++){
+        if(wind_cache[i].lenght == 0){
+            entry = &wind_cache[i];
+            break;
+        }
+        if(wind_cache[i].last_use < entry->last_use){
+            entry = &wind_cache[i];
+        }
+    }
+    if(entry->lenght != signal_lenght){
+        free(entry->values);
+        entry->values = (float *)malloc(signal_lenght * sizeof(float));
+        if(entry->values == NULL){
+            entry->lenght = 0;
+            return NULL;
+        }
+        entry->lenght = signal_lenght;
+    }
+    WindowGenerate(entry->values, window, signal_lenght);
+    entry->type = window;
+    entry->last_use = ++wind_time;
+    return entry->values;
+}
+
+/**
+ * @brief Generate the cos/sin table for the real FFT post-processing of signals up to table_size
+ * (only the first quarter of the circle is needed)
+ */
+static void RealTableGenerate(float * table, uint16_t table_size){
+    for (int i = 0; i <= table_size / 4; i++){
+        table[2 * i] = cosf(2 * M_PI * i / table_size);
+        table[2 * i + 1] = sinf(2 * M_PI * i / table_size);
+    }
+}
+
+/**
+ * @brief Complex FFT (with bit reverse) using the global tables
+ */
+static void ComplexFFT(float * data, uint16_t n_points){
+    if(algorithm == FFT_RADIX_4){
+        dsps_fft2r_r4_fc32(data, n_points);
+    } else {
+        dsps_fft2r_fc32(data, n_points);
+    }
+    dsps_bit_rev_fc32(data, n_points);
+}
+
+/**
+ * @brief Complex FFT (with bit reverse) using the tables of a plan
+ */
+static void PlanComplexFFT(fft_plan_t * plan, float * data){
+    if(algorithm == FFT_RADIX_4){
+        dsps_fft2r_r4_plan_fc32(&plan->fft, data);
+    } else {
+        dsps_fft2r_plan_fc32(&plan->fft, data);
+    }
+    dsps_bit_rev_plan_fc32(&plan->fft, data);
+}
+
+/**
+ * @brief Multiply the complex values by scale and conjugate them
+ */
+static void ConjugateScale(float * data, uint16_t n_points, float scale){
+    if(scale != 1){
+        dsps_mulc_f32(data, data, n_points, scale, 2, 2);
+    }
+    dsps_mulc_f32(&data[1], &data[1], n_points, -scale, 2, 2);
+}
+
+/**
+ * @brief Separate the spectrum of the real signal from the half lenght FFT (already bit
+ * reversed) and store the selected output
+ */
+static void SpectrumOutput(float * data, float * fft, uint16_t signal_lenght, const float * table, uint16_t table_size, fft_output_t output){
+    // Magnitude scale of bin 0 and of bins k > 0. The latter is the same as the full lenght
+    // complex FFT followed by dsps_cplx2reC_fc32(), which adds each bin k > 0 with the
+    // conjugate of bin N - k (doubling it)
+    float scale_0 = 1.0f / (signal_lenght / 2);
+    float scale = 4.0f / (signal_lenght / 2);
+    // Separate the spectrum of the real signal (bins 0 to signal_lenght / 2 - 1)
+    dsps_cplx2real2r_fc32(data, signal_lenght / 2, table, table_size);
+    // Imaginary part of bin 0 holds the Nyquist bin, which is not returned
+    data[1] = 0;
+    switch(output){
+        case FFT_MAGNITUDE:
+            dsps_mag_fc32(data, fft, 1, scale_0);
+            dsps_mag_fc32(&data[2], &fft[1], signal_lenght / 2 - 1, scale);
+        break;
+        case FFT_POWER:
+            dsps_power_fc32(data, fft, 1, scale_0 * scale_0);
+            dsps_power_fc32(&data[2], &fft[1], signal_lenght / 2 - 1, scale * scale);
+        break;
+        case FFT_DB:
+            dsps_power_db_fc32(data, fft, 1, scale_0 * scale_0);
+            dsps_power_db_fc32(&data[2], &fft[1], signal_lenght / 2 - 1, scale * scale);
+        break;
+    }
+}
 
 /*==================[external functions definition]==========================*/
 bool FFTInit(void){
@@ -34,29 +207,153 @@ bool FFTInit(void){
     if (ret != ESP_OK){
         return false;
     }
+    // Twiddles for signals up to MAX_SIGNAL_LENGHT
+    RealTableGenerate(fft_real_w, MAX_SIGNAL_LENGHT);
     return true;
 }
 
 void FFTMagnitude(float * signal, float * fft, uint16_t signal_lenght){
-    // Generate Hann window
-    dsps_wind_hann_f32(wind, signal_lenght);
-    // Clear fft array
-    memset(fft_complex, 0, 2 * MAX_SIGNAL_LENGHT * sizeof(float));
-    // Multiply input array with window and store as real part
-    dsps_mul_f32(signal, wind, fft_complex, signal_lenght, 1, 1, 2);    
-    // Calculate FFT  
-    dsps_fft2r_fc32(fft_complex, signal_lenght);
-    // Bit reverse
-    dsps_bit_rev_fc32(fft_complex, signal_lenght);
-    // Convert one complex vector to two complex vectors
-    dsps_cplx2reC_fc32(fft_complex, signal_lenght);
-    // Calculate FFT magnitude 
-    for (int j = 0; j < signal_lenght; j++){
-            fft_complex[j] = 2*(sqrt(fft_complex[j*2+0]*fft_complex[j*2+0] + fft_complex[j*2+1]*fft_complex[j*2+1])) / (signal_lenght/2);
-    }
-    fft_complex[0] = fft_complex[0] / 2;
-    // Copy result in fft array
-    memcpy(fft, fft_complex, (signal_lenght / 2) * sizeof(float));
+    FFTMagnitudeWindow(signal, fft, signal_lenght, FFT_HANN);
+}
+
+void FFTMagnitudeWindow(float * signal, float * fft, uint16_t signal_lenght, fft_window_t window){
+    FFTSpectrum(signal, fft, signal_lenght, window, FFT_MAGNITUDE);
+}
+
+void FFTSpectrum(float * signal, float * fft, uint16_t signal_lenght, fft_window_t window, fft_output_t output){
+    // Generate window (only when it is not in the cache)
+    const float *wind = WindowGet(window, signal_lenght);
+    if(wind == NULL){
+        // Not enough memory to keep it, the window is generated in the FFT buffer
+        WindowGenerate(fft_complex, window, signal_lenght);
+        wind = fft_complex;
+    }
+    // Multiply input array with window. Even samples are stored as real part and odd
+    // samples as imaginary part of a signal_lenght / 2 complex array
+    dsps_mul_f32(signal, wind, fft_complex, signal_lenght, 1, 1, 1);
+    // Calculate FFT of half the lenght
+    ComplexFFT(fft_complex, signal_lenght / 2);
+    SpectrumOutput(fft_complex, fft, signal_lenght, fft_real_w, MAX_SIGNAL_LENGHT, output);
+}
+
+bool FFTPlanInit(fft_plan_t * plan, uint16_t signal_lenght, fft_window_t window){
+    if((signal_lenght < 4) || ((signal_lenght & (signal_lenght - 1)) != 0)){
+        return false;
+    }
+    plan->lenght = signal_lenght;
+    plan->window = window;
+    plan->fft.w = NULL;
+    plan->wind = NULL;
+    if(window != FFT_RECTANGULAR){
+        plan->wind = (float *)malloc(signal_lenght * sizeof(float));
+    }
+    plan->data = (float *)malloc(signal_lenght * sizeof(float));
+    plan->real_w = (float *)malloc(2 * (signal_lenght / 4 + 1) * sizeof(float));
+    // Twiddle and bit reverse tables are shared with other plans of the same lenght
+    if(((plan->wind == NULL) && (window != FFT_RECTANGULAR)) || (plan->data == NULL) || (plan->real_w == NULL) ||
+        (dsps_fft2r_plan_init_fc32(&plan->fft, signal_lenght / 2) != ESP_OK)){
+        FFTPlanDeinit(plan);
+        return false;
+    }
+    if(plan->wind != NULL){
+        WindowGenerate(plan->wind, window, signal_lenght);
+    }
+    RealTableGenerate(plan->real_w, signal_lenght);
+    return true;
+}
+
+void FFTPlanDeinit(fft_plan_t * plan){
+    free(plan->wind);
+    free(plan->data);
+    free(plan->real_w);
+    plan->wind = NULL;
+    plan->data = NULL;
+    plan->real_w = NULL;
+    dsps_fft2r_plan_deinit_fc32(&plan->fft);
+}
+
+void FFTPlanSpectrum(fft_plan_t * plan, const float * signal, float * fft, fft_output_t output){
+    if(plan->wind == NULL){
+        // Rectangular window, same scale as in WindowGenerate()
+        dsps_mulc_f32(signal, plan->data, plan->lenght, 0.5, 1, 1);
+    } else {
+        dsps_mul_f32(signal, plan->wind, plan->data, plan->lenght, 1, 1, 1);
+    }
+    PlanComplexFFT(plan, plan->data);
+    SpectrumOutput(plan->data, fft, plan->lenght, plan->real_w, plan->lenght, output);
+}
+
+void FFTForward(const float * signal, float * spectrum, uint16_t signal_lenght){
+    if(spectrum != signal){
+        memcpy(spectrum, signal, signal_lenght * sizeof(float));
+    }
+    ComplexFFT(spectrum, signal_lenght / 2);
+    dsps_cplx2real2r_fc32(spectrum, signal_lenght / 2, fft_real_w, MAX_SIGNAL_LENGHT);
+}
+
+void FFTInverse(const float * spectrum, float * signal, uint16_t signal_lenght){
+    if(signal != spectrum){
+        memcpy(signal, spectrum, signal_lenght * sizeof(float));
+    }
+    // Spectrum of the half lenght complex signal, inverse FFT calculated as conj(FFT(conj(Z))) / N
+    dsps_real2cplx2r_fc32(signal, signal_lenght / 2, fft_real_w, MAX_SIGNAL_LENGHT);
+    ConjugateScale(signal, signal_lenght / 2, 1);
+    ComplexFFT(signal, signal_lenght / 2);
+    ConjugateScale(signal, signal_lenght / 2, 2.0f / signal_lenght);
+}
+
+void FFTPlanForward(fft_plan_t * plan, const float * signal, float * spectrum){
+    if(spectrum != signal){
+        memcpy(spectrum, signal, plan->lenght * sizeof(float));
+    }
+    PlanComplexFFT(plan, spectrum);
+    dsps_cplx2real2r_fc32(spectrum, plan->lenght / 2, plan->real_w, plan->lenght);
+}
+
+void FFTPlanInverse(fft_plan_t * plan, const float * spectrum, float * signal){
+    if(signal != spectrum){
+        memcpy(signal, spectrum, plan->lenght * sizeof(float));
+    }
+    dsps_real2cplx2r_fc32(signal, plan->lenght / 2, plan->real_w, plan->lenght);
+    ConjugateScale(signal, plan->lenght / 2, 1);
+    PlanComplexFFT(plan, signal);
+    ConjugateScale(signal, plan->lenght / 2, 2.0f / plan->lenght);
+}
+
+void FFTSpectrumMultiply(const float * spectrum_a, const float * spectrum_b, float * product, uint16_t signal_lenght){
+    float re, im;
+    // Bin 0 and Nyquist bin are real
+    product[0] = spectrum_a[0] * spectrum_b[0];
+    product[1] = spectrum_a[1] * spectrum_b[1];
+    for(uint16_t i = 2; i < signal_lenght; i += 2){
+        re = spectrum_a[i] * spectrum_b[i] - spectrum_a[i + 1] * spectrum_b[i + 1];
+        im = spectrum_a[i] * spectrum_b[i + 1] + spectrum_a[i + 1] * spectrum_b[i];
+        product[i] = re;
+        product[i + 1] = im;
+    }
+}
+
+void FFTSpectrumMultiplyAdd(const float * spectrum_a, const float * spectrum_b, float * accumulator, uint16_t signal_lenght){
+    accumulator[0] += spectrum_a[0] * spectrum_b[0];
+    accumulator[1] += spectrum_a[1] * spectrum_b[1];
+    for(uint16_t i = 2; i < signal_lenght; i += 2){
+        accumulator[i] += spectrum_a[i] * spectrum_b[i] - spectrum_a[i + 1] * spectrum_b[i + 1];
+        accumulator[i + 1] += spectrum_a[i] * spectrum_b[i + 1] + spectrum_a[i + 1] * spectrum_b[i];
+    }
+}
+
+void FFTWindowCacheClear(void){
+    for(uint8_t i = 0; i < FFT_WINDOW_CACHE_SIZE; i++){
+        free(wind_cache[i].values);
+        wind_cache[i].values = NULL;
+        wind_cache[i].lenght = 0;
+        wind_cache[i].last_use = 0;
+    }
+    wind_time = 0;
+}
+
+void FFTSetAlgorithm(fft_algorithm_t fft_algorithm){
+    algorithm = fft_algorithm;
 }
 
 void FFTFrequency(float sample_freq, uint16_t signal_lenght, float * f){
@@ -0,0 +1,167 @@
+/**
+ * @file fft_fixed.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdlib.h>
+#include <math.h>
+#include "fft_fixed.h"
+#include "esp_dsp.h"
+/*==================[macros and definitions]=================================*/
+#define ADC_MID_SCALE       (1 << (FFT_FIXED_ADC_BITS - 1))
+#define ADC_SHIFT           (16 - FFT_FIXED_ADC_BITS)   /*!< Centered counts are shifted to use the 16 bits */
+#define Q15                 32768.0f
+/*==================[internal data declaration]==============================*/
+static int16_t fft_data[MAX_SIGNAL_LENGHT];                   /*!< Real signal packed as MAX_SIGNAL_LENGHT / 2 complex values */
+static int16_t wind[MAX_SIGNAL_LENGHT];                       /*!< Window (Q15) of type wind_type and lenght wind_lenght */
+static fft_window_t wind_type;
+static uint16_t wind_lenght = 0;                              /*!< 0: window not generated yet */
+static float wind_gain;                                       /*!< Correction for the window coherent gain */
+static int16_t fft_real_w[2 * (MAX_SIGNAL_LENGHT / 4 + 1)];   /*!< cos/sin table (Q15) for the real FFT post-processing */
+static const float wind_coeffs[][5] = {                       /*!< Cosine sum coefficients of each fft_window_t */
+    [FFT_HANN]              = {0.5, 0.5, 0, 0, 0},
+    [FFT_BLACKMAN]          = {0.42, 0.5, 0.08, 0, 0},
+    [FFT_BLACKMAN_HARRIS]   = {0.35875, 0.48829, 0.14128, 0.01168, 0},
+    [FFT_BLACKMAN_NUTTALL]  = {0.3635819, 0.4891775, 0.1365995, 0.0106411, 0},
+    [FFT_NUTTALL]           = {0.355768, 0.487396, 0.144232, 0.012604, 0},
+    [FFT_FLAT_TOP]          = {0.21557895, 0.41663158, 0.277263158, 0.083578947, 0.006947368},
+    [FFT_RECTANGULAR]       = {1, 0, 0, 0, 0},
+};
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Generate the window only if the type or the lenght changed since the last call
+ *
+ * The Q15 values are calculated directly, with the same cosine sums as the dsps_wind_*_f32()
+ * windows: w[i] = a0 - a1 * cos(x) + a2 * cos(2 * x) - a3 * cos(3 * x) + a4 * cos(4 * x),
+ * with x = 2 * pi * i / (lenght - 1).
+ * As in the float FFT module, a tone gives the same magnitude with all the windows.
+ * The Q15 window is not scaled (it would overflow), the correction is applied to the magnitude.
+ */
+static void WindowUpdate(fft_window_t window, uint16_t signal_lenght){
+    const float *a = wind_coeffs[window];
+    float x, w;
+    if((window == wind_type) && (signal_lenght == wind_lenght)){
+        return;
+    }
+    for(uint16_t i = 0; i < signal_lenght; i++){
+        x = 2 * M_PI * i / (signal_lenght - 1);
+        w = a[0] - a[1] * cosf(x) + a[2] * cosf(2 * x) - a[3] * cosf(3 * x) + a[4] * cosf(4 * x);
+        int32_t q = lrintf(w * Q15);
+        // Flat-top window is slightly negative at the edges
+        wind[i] = (q > INT16_MAX) ? INT16_MAX : ((q < INT16_MIN) ? INT16_MIN : q);
+    }
+    wind_gain = 0.5 / a[0];
+    wind_type = window;
+    wind_lenght = signal_lenght;
+}
+
+/**
+ * @brief Square root rounded to the nearest integer
+ */
+static uint32_t ISqrt(uint32_t value){
+    uint32_t root = 0;
+    uint32_t bit = 1UL << 30;
+    while(bit > value){
+        bit >>= 2;
+    }
+    while(bit != 0){
+        if(value >= root + bit){
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    // value is now the remainder (value - root^2)
+    if(value > root){
+        root++;
+    }
+    return root;
+}
+
+/**
+ * @brief Squared magnitude of a complex value with |x| < 2^16
+ */
+static inline uint32_t SquaredMagnitude(int32_t re, int32_t im){
+    uint32_t a = abs(re);
+    uint32_t b = abs(im);
+    return a * a + b * b;
+}
+/*==================[external functions definition]==========================*/
+bool FFTFixedInit(void){
+    esp_err_t ret = dsps_fft2r_init_sc16(NULL, CONFIG_DSP_MAX_FFT_SIZE);
+    if (ret != ESP_OK){
+        return false;
+    }
+    // Twiddles for signals up to MAX_SIGNAL_LENGHT (only the first quarter of the circle is needed)
+    for (int i = 0; i <= MAX_SIGNAL_LENGHT / 4; i++){
+        fft_real_w[2 * i] = lrintf(INT16_MAX * cosf(2 * M_PI * i / MAX_SIGNAL_LENGHT));
+        fft_real_w[2 * i + 1] = lrintf(INT16_MAX * sinf(2 * M_PI * i / MAX_SIGNAL_LENGHT));
+    }
+    return true;
+}
+
+void FFTFixedMagnitude(const uint16_t * signal, float * fft, uint16_t signal_lenght, fft_window_t window){
+    uint16_t n = signal_lenght / 2;                 // Complex points
+    uint16_t step = MAX_SIGNAL_LENGHT / signal_lenght;
+    sc16_t *z = (sc16_t *)fft_data;
+    int exponent;
+    float scale;
+    WindowUpdate(window, signal_lenght);
+    // Center, scale to 16 bits and multiply with window. Even samples are stored as
+    // real part and odd samples as imaginary part of a signal_lenght / 2 complex array
+    for(uint16_t i = 0; i < signal_lenght; i++){
+        int32_t x = ((int32_t)signal[i] - ADC_MID_SCALE) * (1 << ADC_SHIFT);
+        fft_data[i] = (x * wind[i] + (1 << 14)) >> 15;
+    }
+    // Calculate FFT of half the lenght
+    dsps_fft2r_sc16_bfp(fft_data, n, &exponent);
+    // Bit reverse
+    dsps_bit_rev_sc16_ansi(fft_data, n);
+    // Same scale as FFTMagnitudeWindow(), referred to ADC counts
+    scale = ldexpf(wind_gain / n, exponent - ADC_SHIFT);
+    // Bin 0 is real (imaginary part of z[0] holds the Nyquist bin)
+    fft[0] = scale * abs(z[0].re + z[0].im);
+    // Bins k and n - k are separated from z[k] and z[n - k] (as dsps_cplx2real2r_fc32 does)
+    // and their magnitude calculated in 32 bits
+    for(uint16_t k = 1; k <= n / 2; k++){
+        sc16_t zk = z[k];
+        sc16_t zn = z[n - k];
+        // 2 * E and 2 * O
+        int32_t e_re = zk.re + zn.re;
+        int32_t e_im = zk.im - zn.im;
+        int32_t o_re = zk.im + zn.im;
+        int32_t o_im = zn.re - zk.re;
+        int32_t c = fft_real_w[2 * k * step];
+        int32_t s = fft_real_w[2 * k * step + 1];
+        // 2 * W^k * O (products halved before the addition to stay inside 32 bits)
+        int32_t t_re = ((c * o_re) >> 1) + ((s * o_im) >> 1);
+        int32_t t_im = ((c * o_im) >> 1) - ((s * o_re) >> 1);
+        t_re = (t_re + (1 << 13)) >> 14;
+        t_im = (t_im + (1 << 13)) >> 14;
+        // X / 2, so the squared magnitude fits in 32 bits
+        int32_t x_re = (e_re + t_re + 2) >> 2;
+        int32_t x_im = (e_im + t_im + 2) >> 2;
+        // Bins k > 0 have 4 times the scale of bin 0 (see fft.c) and X was halved
+        fft[k] = 8 * scale * ISqrt(SquaredMagnitude(x_re, x_im));
+        x_re = (e_re - t_re + 2) >> 2;
+        x_im = (t_im - e_im + 2) >> 2;
+        fft[n - k] = 8 * scale * ISqrt(SquaredMagnitude(x_re, x_im));
+    }
+}
+
+/*==================[end of file]============================================*/
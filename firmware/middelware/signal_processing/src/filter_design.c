@@ -0,0 +1,552 @@
+/**
+ * @file filter_design.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+#include <complex.h>
+#include "filter_design.h"
+#include "iir_filter.h"
+#include "esp_dsp.h"
+/*==================[macros and definitions]=================================*/
+#define BESSEL_ITERATIONS   200     /*!< Iterations of the polynomial root search */
+
+/**
+ * @brief Parameters that identify a design in the cache (unused ones are 0)
+ */
+typedef struct {
+    uint8_t fir;            /*!< 1 for FIR designs */
+    uint8_t type;           /*!< Prototype or window */
+    uint8_t band;           /*!< Frequency response */
+    uint16_t size;          /*!< Order or taps */
+    float sample_frec;      /*!< Sample frequency */
+    float frec_1;           /*!< Cut-off frequency or lower band edge */
+    float frec_2;           /*!< Upper band edge */
+    float param;            /*!< Ripple or Kaiser beta */
+} design_key_t;
+
+/**
+ * @brief Design kept in the cache
+ */
+typedef struct {
+    design_key_t key;       /*!< Parameters of the design */
+    float *coeffs;          /*!< Coefficients, NULL for an empty entry */
+    uint16_t lenght;        /*!< Number of coefficients */
+    uint32_t last_use;      /*!< Time of the last request, for replacement */
+} design_entry_t;
+/*==================[internal data declaration]==============================*/
+static design_entry_t cache[DESIGN_CACHE_SIZE];
+static uint32_t cache_time;
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Copy the coefficients of a cached design, if there is one with the same parameters
+ */
+static bool CacheGet(const design_key_t *key, float *coeffs, uint16_t lenght){
+    for(uint8_t i = 0; i < DESIGN_CACHE_SIZE; i++){
+        if((cache[i].coeffs != NULL) && (cache[i].lenght == lenght) &&
+            (memcmp(&cache[i].key, key, sizeof(design_key_t)) == 0)){
+            memcpy(coeffs, cache[i].coeffs, lenght * sizeof(float));
+            cache[i].last_use = ++cache_time;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Keep a design in an empty entry, or in place of the least recently used one
+ */
+static void CachePut(const design_key_t *key, const float *coeffs, uint16_t lenght){
+    design_entry_t *entry = &cache[0];
+    for(uint8_t i = 0; i < DESIGN_CACHE_SIZE; i++){
+        if(cache[i].coeffs == NULL){
+            entry = &cache[i];
+            break;
+        }
+        if(cache[i].last_use < entry->last_use){
+            entry = &cache[i];
+        }
+    }
+    if(entry->lenght != lenght){
+        free(entry->coeffs);
+        entry->coeffs = (float *)malloc(lenght * sizeof(float));
+        if(entry->coeffs == NULL){
+            entry->lenght = 0;
+            return;
+        }
+        entry->lenght = lenght;
+    }
+    memcpy(entry->coeffs, coeffs, lenght * sizeof(float));
+    entry->key = *key;
+    entry->last_use = ++cache_time;
+}
+
+/**
+ * @brief Magnitude of a real polynomial (a[order] = 1) at s = jw
+ */
+static double PolynomialMagnitude(const double *a, uint8_t order, double w){
+    double complex p = 1;
+    for(int8_t k = order - 1; k >= 0; k--){
+        p = p * (w * I) + a[k];
+    }
+    return cabs(p);
+}
+
+/**
+ * @brief Poles of the reverse Bessel polynomial of the given order, scaled for -3 dB at 1 rad/s
+ */
+static void BesselPoles(uint8_t order, double complex *poles){
+    double a[DESIGN_MAX_IIR_ORDER + 1];
+    double complex num, den;
+    double lo, hi, mid;
+    // a[k] = (2n - k)! / (2^(n - k) k! (n - k)!), from a[n] = 1
+    a[order] = 1;
+    for(int8_t k = order - 1; k >= 0; k--){
+        a[k] = a[k + 1] * (2 * order - k) * (k + 1) / (2.0 * (order - k));
+    }
+    // Durand-Kerner iteration, all the roots at once
+    for(uint8_t i = 0; i < order; i++){
+        poles[i] = cpow(0.4 + 0.9 * I, i);
+    }
+    for(uint16_t it = 0; it < BESSEL_ITERATIONS; it++){
+        for(uint8_t i = 0; i < order; i++){
+            num = 1;
+            den = 1;
+            for(int8_t k = order - 1; k >= 0; k--){
+                num = num * poles[i] + a[k];
+            }
+            for(uint8_t j = 0; j < order; j++){
+                if(j != i){
+                    den *= poles[i] - poles[j];
+                }
+            }
+            poles[i] -= num / den;
+        }
+    }
+    // |H(jw)| = a[0] / |polynomial(jw)| is 1 / sqrt(2) at the -3 dB frequency (bisection)
+    hi = 1;
+    while(PolynomialMagnitude(a, order, hi) < M_SQRT2 * a[0]){
+        hi *= 2;
+    }
+    lo = 0;
+    for(uint8_t it = 0; it < 60; it++){
+        mid = (lo + hi) / 2;
+        if(PolynomialMagnitude(a, order, mid) > M_SQRT2 * a[0]){
+            hi = mid;
+        } else {
+            lo = mid;
+        }
+    }
+    for(uint8_t i = 0; i < order; i++){
+        poles[i] /= (lo + hi) / 2;
+    }
+}
+
+/**
+ * @brief Natural frequency (rad/s) and Q of each section of the normalized low pass prototype.
+ * A Q of 0 is a first order section (real pole). Sections are ordered by decreasing Q.
+ * Fails if the Bessel root search does not give order / 2 complex pairs (and a real pole for
+ * odd orders).
+ */
+static bool Prototype(design_iir_t type, uint8_t order, float ripple, float *w0, float *q){
+    double complex poles[DESIGN_MAX_IIR_ORDER];
+    double theta, sigma, omega, v, tmp;
+    uint8_t pairs = order / 2;
+    uint8_t n = 0;
+    switch(type){
+        case DESIGN_BUTTERWORTH:
+            for(uint8_t k = 0; k < pairs; k++){
+                w0[k] = 1;
+                q[k] = 1.0f / (2.0f * sinf((2 * k + 1) * M_PI / (2.0f * order)));
+            }
+            if(order & 1){
+                w0[pairs] = 1;
+            }
+        break;
+        case DESIGN_CHEBYSHEV:
+            v = asinh(1.0 / sqrt(pow(10, ripple / 10.0) - 1)) / order;
+            for(uint8_t k = 0; k < pairs; k++){
+                theta = (2 * k + 1) * M_PI / (2.0 * order);
+                sigma = sinh(v) * sin(theta);
+                omega = cosh(v) * cos(theta);
+                w0[k] = sqrt(sigma * sigma + omega * omega);
+                q[k] = w0[k] / (2 * sigma);
+            }
+            if(order & 1){
+                w0[pairs] = sinh(v);
+            }
+        break;
+        case DESIGN_BESSEL:
+            BesselPoles(order, poles);
+            if(order & 1){
+                w0[pairs] = 0;
+            }
+            for(uint8_t i = 0; i < order; i++){
+                if(cimag(poles[i]) > 1e-9){
+                    if(n == pairs){
+                        return false;
+                    }
+                    w0[n] = cabs(poles[i]);
+                    q[n] = w0[n] / (-2 * creal(poles[i]));
+                    n++;
+                } else if(fabs(cimag(poles[i])) <= 1e-9){
+                    if(!(order & 1)){
+                        return false;
+                    }
+                    w0[pairs] = -creal(poles[i]);
+                }
+            }
+            if((n != pairs) || ((order & 1) && !(w0[pairs] > 0))){
+                return false;
+            }
+            for(uint8_t i = 1; i < pairs; i++){
+                for(uint8_t j = i; (j > 0) && (q[j] > q[j - 1]); j--){
+                    tmp = q[j]; q[j] = q[j - 1]; q[j - 1] = tmp;
+                    tmp = w0[j]; w0[j] = w0[j - 1]; w0[j - 1] = tmp;
+                }
+            }
+        break;
+    }
+    if(order & 1){
+        q[pairs] = 0;
+    }
+    return true;
+}
+
+/**
+ * @brief Even order Chebyshev filters start at the bottom of the ripple
+ */
+static void RippleGain(float *coeffs, design_iir_t type, uint8_t order, float ripple){
+    float gain;
+    if((type == DESIGN_CHEBYSHEV) && !(order & 1)){
+        gain = 1.0f / sqrtf(powf(10, ripple / 10.0f));
+        for(uint8_t i = 0; i < 3; i++){
+            coeffs[i] *= gain;
+        }
+    }
+}
+
+/**
+ * @brief Bilinear transform (s = (1 - z^-1) / (1 + z^-1), frequencies already pre-warped) of the
+ * analog section (n2 s^2 + n1 s + n0) / (s^2 + d1 s + d0)
+ */
+static void BilinearSection(float *c, double n2, double n1, double n0, double d1, double d0){
+    double a0 = 1 + d1 + d0;
+    c[0] = (n2 + n1 + n0) / a0;
+    c[1] = 2 * (n0 - n2) / a0;
+    c[2] = (n2 - n1 + n0) / a0;
+    c[3] = 2 * (d0 - 1) / a0;
+    c[4] = (1 - d1 + d0) / a0;
+}
+
+/**
+ * @brief Sections of a low or high pass filter, with the bilinear transform of the prototype
+ * (f is the cut-off frequency normalized to the sample frequency)
+ */
+static void LowHighSections(float *coeffs, design_iir_t type, bool high, float f, uint8_t order, float ripple,
+                            const float *w0, const float *q){
+    float wc = tanf(M_PI * f);
+    float k;
+    uint8_t n = (order + 1) / 2;
+    for(uint8_t s = 0; s < n; s++){
+        float *c = &coeffs[s * IIR_SOS_COEFFS];
+        // Pre-warped analog frequency of the section (w0 -> 1 / w0 for high pass)
+        k = high ? (wc / w0[s]) : (wc * w0[s]);
+        if(q[s] > 0){
+            if(high){
+                dsps_biquad_gen_hpf_f32(c, atanf(k) / M_PI, q[s]);
+            } else {
+                dsps_biquad_gen_lpf_f32(c, atanf(k) / M_PI, q[s]);
+            }
+        } else {
+            c[0] = (high ? 1 : k) / (1 + k);
+            c[1] = high ? -c[0] : c[0];
+            c[2] = 0;
+            c[3] = (k - 1) / (k + 1);
+            c[4] = 0;
+        }
+    }
+    RippleGain(coeffs, type, order, ripple);
+}
+
+/**
+ * @brief Sections of a band stop filter, with the low pass to band stop transform of the prototype,
+ * s -> bw * s / (s^2 + wc^2), and the bilinear transform (f1 and f2 are the band edges normalized
+ * to the sample frequency). Each pole of the prototype gives a section with zeros at +-j * wc,
+ * the pairs of complex poles give two sections.
+ */
+static void BandStopSections(float *coeffs, design_iir_t type, float f1, float f2, uint8_t order, float ripple,
+                             const float *w0, const float *q){
+    double w1 = tan(M_PI * f1);
+    double w2 = tan(M_PI * f2);
+    double wc2 = w1 * w2;
+    double bw = w2 - w1;
+    double complex pole, r, d;
+    double complex roots[2];
+    uint8_t pairs = order / 2;
+    float *c = coeffs;
+    for(uint8_t s = 0; s < pairs; s++){
+        // Pole of the prototype section, its transformed poles are the roots of s^2 - bw / pole * s + wc^2
+        pole = w0[s] * (-1.0 / (2 * q[s]) + csqrt(1.0 / (4.0 * q[s] * q[s]) - 1));
+        r = bw / pole;
+        d = csqrt(r * r - 4 * wc2);
+        roots[0] = (r + d) / 2;
+        roots[1] = (r - d) / 2;
+        for(uint8_t i = 0; i < 2; i++){
+            // Each root with its conjugate, gain 1 at 0 Hz
+            double d0 = creal(roots[i]) * creal(roots[i]) + cimag(roots[i]) * cimag(roots[i]);
+            BilinearSection(c, d0 / wc2, 0, d0, -2 * creal(roots[i]), d0);
+            c += IIR_SOS_COEFFS;
+        }
+    }
+    if(order & 1){
+        // Real pole -w0: s^2 + bw / w0 * s + wc^2
+        BilinearSection(c, 1, 0, wc2, bw / w0[pairs], wc2);
+    }
+    RippleGain(coeffs, type, order, ripple);
+}
+
+/**
+ * @brief Modified Bessel function of first kind and order 0
+ */
+static double BesselI0(double x){
+    double sum = 1;
+    double term = 1;
+    for(uint8_t k = 1; k < 50; k++){
+        term *= (x / (2 * k)) * (x / (2 * k));
+        sum += term;
+        if(term < 1e-10 * sum){
+            break;
+        }
+    }
+    return sum;
+}
+
+/**
+ * @brief Ideal low pass response of cut-off f (normalized to the sample frequency) at sample m
+ * from the center
+ */
+static float IdealLowPass(float f, float m){
+    float x = 2 * f * m;
+    if(fabsf(x) < 1e-9f){
+        return 2 * f;
+    }
+    return sinf(M_PI * x) / (M_PI * m);
+}
+
+/**
+ * @brief Check the frequencies of a design
+ */
+static bool FrequenciesValid(design_band_t band, float sample_frec, float frec_1, float frec_2){
+    if((sample_frec <= 0) || (frec_1 <= 0) || (frec_1 >= sample_frec / 2)){
+        return false;
+    }
+    if(((band == DESIGN_BAND_PASS) || (band == DESIGN_BAND_STOP)) &&
+        ((frec_2 <= frec_1) || (frec_2 >= sample_frec / 2))){
+        return false;
+    }
+    return true;
+}
+/*==================[external functions definition]==========================*/
+uint8_t DesignIirSections(design_band_t band, uint8_t order){
+    uint16_t n = (order + 1) / 2;
+    switch(band){
+        case DESIGN_BAND_PASS:
+            n *= 2;
+        break;
+        case DESIGN_BAND_STOP:
+            n = order;
+        break;
+        default:
+        break;
+    }
+    return (n > UINT8_MAX) ? 0 : n;
+}
+
+bool DesignIir(float *coeffs, design_iir_t type, design_band_t band, float sample_frec, float frec_1, float frec_2, uint8_t order, float ripple){
+    design_key_t key;
+    uint8_t n = DesignIirSections(band, order);
+    float f1 = frec_1 / sample_frec;
+    float f2 = frec_2 / sample_frec;
+    float *w0, *q;
+    bool designed;
+    if((n == 0) || ((type == DESIGN_BESSEL) && (order > DESIGN_MAX_IIR_ORDER)) ||
+        !FrequenciesValid(band, sample_frec, frec_1, frec_2) || ((type == DESIGN_CHEBYSHEV) && (ripple <= 0))){
+        return false;
+    }
+    memset(&key, 0, sizeof(design_key_t));
+    key.type = type;
+    key.band = band;
+    key.size = order;
+    key.sample_frec = sample_frec;
+    key.frec_1 = frec_1;
+    key.frec_2 = ((band == DESIGN_BAND_PASS) || (band == DESIGN_BAND_STOP)) ? frec_2 : 0;
+    key.param = (type == DESIGN_CHEBYSHEV) ? ripple : 0;
+    if(CacheGet(&key, coeffs, n * IIR_SOS_COEFFS)){
+        return true;
+    }
+    // Prototype sections (natural frequency and Q)
+    w0 = (float *)malloc(2 * ((order + 1) / 2) * sizeof(float));
+    if(w0 == NULL){
+        return false;
+    }
+    q = &w0[(order + 1) / 2];
+    designed = Prototype(type, order, ripple, w0, q);
+    if(designed){
+        switch(band){
+            case DESIGN_LOW_PASS:
+                LowHighSections(coeffs, type, false, f1, order, ripple, w0, q);
+            break;
+            case DESIGN_HIGH_PASS:
+                LowHighSections(coeffs, type, true, f1, order, ripple, w0, q);
+            break;
+            case DESIGN_BAND_PASS:
+                LowHighSections(coeffs, type, true, f1, order, ripple, w0, q);
+                LowHighSections(&coeffs[(n / 2) * IIR_SOS_COEFFS], type, false, f2, order, ripple, w0, q);
+            break;
+            case DESIGN_BAND_STOP:
+                BandStopSections(coeffs, type, f1, f2, order, ripple, w0, q);
+            break;
+        }
+        CachePut(&key, coeffs, n * IIR_SOS_COEFFS);
+    }
+    free(w0);
+    return designed;
+}
+
+float DesignKaiserBeta(float attenuation){
+    if(attenuation > 50){
+        return 0.1102f * (attenuation - 8.7f);
+    }
+    if(attenuation >= 21){
+        return 0.5842f * powf(attenuation - 21, 0.4f) + 0.07886f * (attenuation - 21);
+    }
+    return 0;
+}
+
+uint16_t DesignKaiserTaps(float sample_frec, float transition, float attenuation){
+    float taps = (attenuation - 7.95f) / (14.36f * transition / sample_frec) + 1;
+    uint32_t n = (taps < 1) ? 1 : (uint32_t)ceilf(taps);
+    if(n > UINT16_MAX - 1){
+        n = UINT16_MAX - 1;
+    }
+    return n | 1;
+}
+
+bool DesignFir(float *coeffs, uint16_t taps, design_window_t window, float beta, design_band_t band, float sample_frec, float frec_1, float frec_2){
+    design_key_t key;
+    float f1 = frec_1 / sample_frec;
+    float f2 = frec_2 / sample_frec;
+    float f0, m, gain, ideal, ideal_sum;
+    bool complement = (band == DESIGN_HIGH_PASS) || (band == DESIGN_BAND_STOP);
+    if((taps == 0) || !FrequenciesValid(band, sample_frec, frec_1, frec_2) || (complement && !(taps & 1))){
+        // Even lenghts have a zero at sample_frec / 2
+        return false;
+    }
+    memset(&key, 0, sizeof(design_key_t));
+    key.fir = 1;
+    key.type = window;
+    key.band = band;
+    key.size = taps;
+    key.sample_frec = sample_frec;
+    key.frec_1 = frec_1;
+    key.frec_2 = ((band == DESIGN_BAND_PASS) || (band == DESIGN_BAND_STOP)) ? frec_2 : 0;
+    key.param = (window == DESIGN_KAISER) ? beta : 0;
+    if(CacheGet(&key, coeffs, taps)){
+        return true;
+    }
+    // Window first, then multiplied by the ideal response
+    if(taps == 1){
+        coeffs[0] = 1;
+    } else {
+        switch(window){
+            case DESIGN_HAMMING:
+                for(uint16_t i = 0; i < taps; i++){
+                    coeffs[i] = 0.54f - 0.46f * cosf(2 * M_PI * i / (taps - 1));
+                }
+            break;
+            case DESIGN_HANN:
+                dsps_wind_hann_f32(coeffs, taps);
+            break;
+            case DESIGN_BLACKMAN:
+                dsps_wind_blackman_f32(coeffs, taps);
+            break;
+            case DESIGN_KAISER:
+                for(uint16_t i = 0; i < taps; i++){
+                    m = 2.0f * i / (taps - 1) - 1;
+                    coeffs[i] = BesselI0(beta * sqrtf(fmaxf(0, 1 - m * m))) / BesselI0(beta);
+                }
+            break;
+        }
+    }
+    switch(band){
+        case DESIGN_HIGH_PASS:
+            f0 = 0.5f;
+        break;
+        case DESIGN_BAND_PASS:
+            f0 = (f1 + f2) / 2;
+        break;
+        default:
+            f0 = 0;
+        break;
+    }
+    gain = 0;
+    ideal_sum = 0;
+    for(uint16_t i = 0; i < taps; i++){
+        m = i - (taps - 1) / 2.0f;
+        switch(band){
+            case DESIGN_LOW_PASS:
+            case DESIGN_HIGH_PASS:
+                ideal = IdealLowPass(f1, m);
+            break;
+            default:
+                ideal = IdealLowPass(f2, m) - IdealLowPass(f1, m);
+            break;
+        }
+        if(complement){
+            // Spectral inversion: all pass (impulse at the center) minus the response
+            ideal = ((m == 0) ? 1 : 0) - ideal;
+        }
+        coeffs[i] *= ideal;
+        ideal_sum += fabsf(ideal);
+        gain += coeffs[i] * cosf(2 * M_PI * f0 * m);
+    }
+    // The window can cancel the whole response (i.e. 2 taps with Hann or Blackman window, which
+    // are 0 at both ends): only rounding errors would be left to normalize
+    if(!isfinite(gain) || (fabsf(gain) <= FLT_EPSILON * ideal_sum)){
+        return false;
+    }
+    for(uint16_t i = 0; i < taps; i++){
+        coeffs[i] /= gain;
+    }
+    CachePut(&key, coeffs, taps);
+    return true;
+}
+
+void DesignCacheClear(void){
+    for(uint8_t i = 0; i < DESIGN_CACHE_SIZE; i++){
+        free(cache[i].coeffs);
+        cache[i].coeffs = NULL;
+        cache[i].lenght = 0;
+        cache[i].last_use = 0;
+    }
+    cache_time = 0;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,179 @@
+/**
+ * @file fir_filter.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdlib.h>
+#include <string.h>
+#include "fir_filter.h"
+#include "esp_dsp.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Taps per partition: the power of two closest to 2 * sqrt(coeffs_lenght), which
+ * balances the direct form partition against the FFT of each block.
+ */
+static uint16_t BlockLenght(uint16_t coeffs_lenght){
+    uint32_t block = 1;
+    while(block * block < 4 * (uint32_t)coeffs_lenght){
+        block <<= 1;
+    }
+    if(2 * block > MAX_SIGNAL_LENGHT){
+        block = MAX_SIGNAL_LENGHT / 2;
+    }
+    return block;
+}
+
+/**
+ * @brief Calculate the output of the FFT partitions for the next block, with the spectrum of
+ * the frame just completed and the previous ones.
+ */
+static void TailUpdate(fir_filter_t *filter){
+    uint16_t fft_lenght = 2 * filter->block;
+    uint16_t slot;
+    float *spectrum;
+    filter->newest = (filter->newest + 1) % filter->n_parts;
+    spectrum = &filter->spectra[filter->newest * fft_lenght];
+    FFTPlanForward(&filter->plan, filter->frame, spectrum);
+    // The frame of k blocks ago is convolved with partition k
+    memset(filter->tail, 0, fft_lenght * sizeof(float));
+    slot = filter->newest;
+    for(uint16_t p = 0; p < filter->n_parts; p++){
+        FFTSpectrumMultiplyAdd(&filter->spectra[slot * fft_lenght], &filter->parts[p * fft_lenght], filter->tail, fft_lenght);
+        slot = (slot == 0) ? (filter->n_parts - 1) : (slot - 1);
+    }
+    FFTPlanInverse(&filter->plan, filter->tail, filter->tail);
+    // Overlap-save: only the second half of the circular convolution is valid
+    memcpy(filter->tail, &filter->tail[filter->block], filter->block * sizeof(float));
+    memcpy(filter->frame, &filter->frame[filter->block], filter->block * sizeof(float));
+}
+/*==================[external functions definition]==========================*/
+bool FirFilterInit(fir_filter_t *filter, const float *coeffs, uint16_t coeffs_lenght){
+    uint16_t block, fft_lenght, direct_lenght;
+    int32_t tap;
+    if(coeffs_lenght == 0){
+        return false;
+    }
+    memset(filter, 0, sizeof(fir_filter_t));
+    filter->coeffs_lenght = coeffs_lenght;
+    block = 0;
+    if(coeffs_lenght >= FIR_FFT_THRESHOLD){
+        block = BlockLenght(coeffs_lenght);
+    }
+    direct_lenght = (block == 0) ? coeffs_lenght : block;
+    filter->coeffs = (float *)malloc(direct_lenght * sizeof(float));
+    if(filter->coeffs == NULL){
+        return false;
+    }
+    // dsps_fir_f32() applies coeffs[coeffs_lenght - 1] to the newest sample, so the
+    // first partition is the end of the array
+    memcpy(filter->coeffs, &coeffs[coeffs_lenght - direct_lenght], direct_lenght * sizeof(float));
+    if(dsps_fir_init_f32(&filter->direct, filter->coeffs, NULL, direct_lenght) != ESP_OK){
+        FirFilterDeinit(filter);
+        return false;
+    }
+    if(block == 0){
+        return true;
+    }
+    filter->block = block;
+    filter->n_parts = (coeffs_lenght - 1) / block;
+    fft_lenght = 2 * block;
+    filter->frame = (float *)malloc(fft_lenght * sizeof(float));
+    filter->tail = (float *)malloc(fft_lenght * sizeof(float));
+    filter->parts = (float *)calloc(filter->n_parts * fft_lenght, sizeof(float));
+    filter->spectra = (float *)malloc(filter->n_parts * fft_lenght * sizeof(float));
+    if((filter->frame == NULL) || (filter->tail == NULL) || (filter->parts == NULL) || (filter->spectra == NULL) ||
+        !FFTPlanInit(&filter->plan, fft_lenght, FFT_RECTANGULAR)){
+        FirFilterDeinit(filter);
+        return false;
+    }
+    // Partition p holds the taps applied to samples (p + 1) * block to (p + 2) * block - 1 old
+    for(uint16_t p = 0; p < filter->n_parts; p++){
+        for(uint16_t i = 0; i < block; i++){
+            tap = (int32_t)coeffs_lenght - 1 - (p + 1) * block - i;
+            if(tap >= 0){
+                filter->parts[p * fft_lenght + i] = coeffs[tap];
+            }
+        }
+        FFTPlanForward(&filter->plan, &filter->parts[p * fft_lenght], &filter->parts[p * fft_lenght]);
+    }
+    FirFilterReset(filter);
+    return true;
+}
+
+void FirFilterDeinit(fir_filter_t *filter){
+    if(filter->direct.delay != NULL){
+        dsps_fir_f32_free(&filter->direct);
+        filter->direct.delay = NULL;
+    }
+    free(filter->coeffs);
+    free(filter->frame);
+    free(filter->tail);
+    free(filter->parts);
+    free(filter->spectra);
+    filter->coeffs = NULL;
+    filter->frame = NULL;
+    filter->tail = NULL;
+    filter->parts = NULL;
+    filter->spectra = NULL;
+    if(filter->block != 0){
+        FFTPlanDeinit(&filter->plan);
+        filter->block = 0;
+    }
+}
+
+void FirFilterReset(fir_filter_t *filter){
+    memset(filter->direct.delay, 0, filter->direct.N * sizeof(float));
+    filter->direct.pos = 0;
+    if(filter->block != 0){
+        memset(filter->frame, 0, 2 * filter->block * sizeof(float));
+        memset(filter->tail, 0, 2 * filter->block * sizeof(float));
+        memset(filter->spectra, 0, filter->n_parts * 2 * filter->block * sizeof(float));
+        filter->pos = 0;
+        filter->newest = 0;
+    }
+}
+
+void FirFilterProcess(fir_filter_t *filter, const float * input_signal, float * output_signal, uint16_t signal_lenght){
+    uint16_t n;
+    if(filter->block == 0){
+        dsps_fir_f32(&filter->direct, input_signal, output_signal, signal_lenght);
+        return;
+    }
+    while(signal_lenght > 0){
+        // Up to the end of the current block
+        n = filter->block - filter->pos;
+        if(n > signal_lenght){
+            n = signal_lenght;
+        }
+        memcpy(&filter->frame[filter->block + filter->pos], input_signal, n * sizeof(float));
+        dsps_fir_f32(&filter->direct, input_signal, output_signal, n);
+        dsps_add_f32(output_signal, &filter->tail[filter->pos], output_signal, n, 1, 1, 1);
+        filter->pos += n;
+        if(filter->pos == filter->block){
+            TailUpdate(filter);
+            filter->pos = 0;
+        }
+        input_signal += n;
+        output_signal += n;
+        signal_lenght -= n;
+    }
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,119 @@
+/**
+ * @file goertzel.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "goertzel.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+bool GoertzelInit(goertzel_t *goertzel, float sample_frec, const float *freqs, uint8_t n_freqs, uint16_t lenght,
+    void (*func_p)(float *magnitude, void *param_p), void *param_p){
+    if((n_freqs == 0) || (lenght == 0)){
+        return false;
+    }
+    goertzel->n_freqs = n_freqs;
+    goertzel->lenght = lenght;
+    goertzel->func_p = func_p;
+    goertzel->param_p = param_p;
+    goertzel->coeff = (float *)malloc(n_freqs * sizeof(float));
+    goertzel->state = (float *)malloc(2 * n_freqs * sizeof(float));
+    goertzel->magnitude = (float *)calloc(n_freqs, sizeof(float));
+    if((goertzel->coeff == NULL) || (goertzel->state == NULL) || (goertzel->magnitude == NULL)){
+        GoertzelDeinit(goertzel);
+        return false;
+    }
+    for(uint8_t i = 0; i < n_freqs; i++){
+        goertzel->coeff[i] = 2 * cosf(2 * M_PI * freqs[i] / sample_frec);
+    }
+    GoertzelReset(goertzel);
+    return true;
+}
+
+void GoertzelDeinit(goertzel_t *goertzel){
+    free(goertzel->coeff);
+    free(goertzel->state);
+    free(goertzel->magnitude);
+    goertzel->coeff = NULL;
+    goertzel->state = NULL;
+    goertzel->magnitude = NULL;
+    goertzel->n_freqs = 0;
+}
+
+void GoertzelReset(goertzel_t *goertzel){
+    memset(goertzel->state, 0, 2 * goertzel->n_freqs * sizeof(float));
+    goertzel->count = 0;
+    goertzel->blocks = 0;
+}
+
+uint16_t GoertzelProcess(goertzel_t *goertzel, const float *samples, uint32_t n_samples){
+    uint16_t blocks = 0;
+    uint32_t n;
+    float s0, s1, s2, coeff;
+    while(n_samples > 0){
+        // Up to the end of the block
+        n = goertzel->lenght - goertzel->count;
+        if(n > n_samples){
+            n = n_samples;
+        }
+        // Each frequency goes through all the samples, so its state stays in registers
+        for(uint8_t i = 0; i < goertzel->n_freqs; i++){
+            coeff = goertzel->coeff[i];
+            s1 = goertzel->state[2 * i];
+            s2 = goertzel->state[2 * i + 1];
+            for(uint32_t j = 0; j < n; j++){
+                s0 = samples[j] + coeff * s1 - s2;
+                s2 = s1;
+                s1 = s0;
+            }
+            goertzel->state[2 * i] = s1;
+            goertzel->state[2 * i + 1] = s2;
+        }
+        goertzel->count += n;
+        samples += n;
+        n_samples -= n;
+        if(goertzel->count == goertzel->lenght){
+            // |X|^2 = s1^2 + s2^2 - coeff * s1 * s2, magnitude = 2 * |X| / lenght
+            for(uint8_t i = 0; i < goertzel->n_freqs; i++){
+                s1 = goertzel->state[2 * i];
+                s2 = goertzel->state[2 * i + 1];
+                s0 = s1 * s1 + s2 * s2 - goertzel->coeff[i] * s1 * s2;
+                goertzel->magnitude[i] = 2 * sqrtf(fmaxf(s0, 0)) / goertzel->lenght;
+            }
+            memset(goertzel->state, 0, 2 * goertzel->n_freqs * sizeof(float));
+            goertzel->count = 0;
+            goertzel->blocks++;
+            blocks++;
+            if(goertzel->func_p != NULL){
+                goertzel->func_p(goertzel->magnitude, goertzel->param_p);
+            }
+        }
+    }
+    return blocks;
+}
+
+float * GoertzelMagnitude(goertzel_t *goertzel){
+    return goertzel->magnitude;
+}
+
+/*==================[end of file]============================================*/
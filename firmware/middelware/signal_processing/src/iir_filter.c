@@ -10,43 +10,16 @@
  */
 
 /*==================[inclusions]=============================================*/
+#include <stdlib.h>
+#include <string.h>
 #include "iir_filter.h"
+#include "filter_design.h"
 #include "esp_dsp.h"
 /*==================[macros and definitions]=================================*/
-#define N_SOS       5
-#define N_DELAY     2
-// 2nd order Butterworth 
-#define ORDER2_Q    (1 / 1.414)
-// 4th order Butterworth 
-#define ORDER4_Q1   (1 / 0.765)
-#define ORDER4_Q2   (1 / 1.848)
-// 6th order Butterworth 
-#define ORDER6_Q1   (1 / 0.518)
-#define ORDER6_Q2   (1 / 1.414)
-#define ORDER6_Q3   (1 / 1.932)
-// 8th order Butterworth 
-#define ORDER8_Q1   (1 / 0.390)
-#define ORDER8_Q2   (1 / 1.111)
-#define ORDER8_Q3   (1 / 1.663)
-#define ORDER8_Q4   (1 / 1.962)
+
 /*==================[internal data declaration]==============================*/
-static uint8_t lp_order, hp_order;
-float hp2_delay[N_DELAY] = {0, 0};  // delay
-float hp4_delay[N_DELAY] = {0, 0};  // delay
-float hp6_delay[N_DELAY] = {0, 0};  // delay
-float hp8_delay[N_DELAY] = {0, 0};  // delay
-float lp2_delay[N_DELAY] = {0, 0};  // delay
-float lp4_delay[N_DELAY] = {0, 0};  // delay
-float lp6_delay[N_DELAY] = {0, 0};  // delay
-float lp8_delay[N_DELAY] = {0, 0};  // delay
-float lp2_sos_coeff[N_SOS]; 
-float lp4_sos_coeff[N_SOS]; 
-float lp6_sos_coeff[N_SOS]; 
-float lp8_sos_coeff[N_SOS]; 
-float hp2_sos_coeff[N_SOS]; 
-float hp4_sos_coeff[N_SOS]; 
-float hp6_sos_coeff[N_SOS]; 
-float hp8_sos_coeff[N_SOS]; 
+static iir_filter_t lp_filter;      /*!< Instance used by LowPassInit()/LowPassFilter() */
+static iir_filter_t hp_filter;      /*!< Instance used by HiPassInit()/HiPassFilter() */
 /*==================[internal functions declaration]=========================*/
 
 /*==================[internal data definition]===============================*/
@@ -54,103 +27,174 @@ float hp8_sos_coeff[N_SOS];
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+/**
+ * @brief Allocate the coefficients and delay lines of a filter instance
+ */
+static bool IirFilterAlloc(iir_filter_t *filter, uint8_t n_sections, uint8_t channels){
+    if((n_sections == 0) || (channels == 0)){
+        return false;
+    }
+    filter->n_sections = n_sections;
+    filter->n_channels = channels;
+    filter->coeffs = (float *)malloc(filter->n_sections * IIR_SOS_COEFFS * sizeof(float));
+    filter->delay = (float *)malloc(filter->n_channels * filter->n_sections * IIR_SOS_DELAY * sizeof(float));
+    if((filter->coeffs == NULL) || (filter->delay == NULL)){
+        IirFilterDeinit(filter);
+        return false;
+    }
+    IirFilterReset(filter);
+    return true;
+}
+
+/**
+ * @brief Filter one sample through all the sections (same as dsps_biquad_sos_f32())
+ */
+static float SosSample(const float *coef, float *w, uint8_t n_sections, float x){
+    float d0;
+    for(uint8_t k = 0; k < n_sections; k++){
+        d0 = x - coef[3] * w[0] - coef[4] * w[1];
+        x = coef[0] * d0 + coef[1] * w[0] + coef[2] * w[1];
+        w[1] = w[0];
+        w[0] = d0;
+        coef += IIR_SOS_COEFFS;
+        w += IIR_SOS_DELAY;
+    }
+    return x;
+}
+
+/**
+ * @brief Delay lines in steady state for a constant input (as if it was applied forever)
+ */
+static void SosSteadyState(const float *coef, float *w, uint8_t n_sections, float x){
+    for(uint8_t k = 0; k < n_sections; k++){
+        w[0] = x / (1 + coef[3] + coef[4]);
+        w[1] = w[0];
+        x = (coef[0] + coef[1] + coef[2]) * w[0];
+        coef += IIR_SOS_COEFFS;
+        w += IIR_SOS_DELAY;
+    }
+}
 
 /*==================[external functions definition]==========================*/
 
-void LowPassInit(float sample_frec, float cut_frec, filter_order_t order){
-    float f = cut_frec / sample_frec;
-    lp_order = order;
-    switch(lp_order){
-        case ORDER_2:
-            dsps_biquad_gen_lpf_f32(lp2_sos_coeff, f, ORDER2_Q);
-        break;
-        case ORDER_4:
-            dsps_biquad_gen_lpf_f32(lp2_sos_coeff, f, ORDER4_Q1);
-            dsps_biquad_gen_lpf_f32(lp4_sos_coeff, f, ORDER4_Q2);
-        break;
-        case ORDER_6:
-            dsps_biquad_gen_lpf_f32(lp2_sos_coeff, f, ORDER6_Q1);
-            dsps_biquad_gen_lpf_f32(lp4_sos_coeff, f, ORDER6_Q2);
-            dsps_biquad_gen_lpf_f32(lp6_sos_coeff, f, ORDER6_Q3);
-        break;
-        case ORDER_8:
-            dsps_biquad_gen_lpf_f32(lp2_sos_coeff, f, ORDER8_Q1);
-            dsps_biquad_gen_lpf_f32(lp4_sos_coeff, f, ORDER8_Q2);
-            dsps_biquad_gen_lpf_f32(lp6_sos_coeff, f, ORDER8_Q3);
-            dsps_biquad_gen_lpf_f32(lp8_sos_coeff, f, ORDER8_Q4);
-        break;
+bool IirFilterInit(iir_filter_t *filter, filter_type_t type, float sample_frec, float cut_frec, uint8_t order, uint8_t channels){
+    design_band_t band = (type == IIR_HI_PASS) ? DESIGN_HIGH_PASS : DESIGN_LOW_PASS;
+    if((order == 0) || !IirFilterAlloc(filter, DesignIirSections(band, order), channels)){
+        return false;
+    }
+    if(!DesignIir(filter->coeffs, DESIGN_BUTTERWORTH, band, sample_frec, cut_frec, 0, order, 0)){
+        IirFilterDeinit(filter);
+        return false;
     }
+    return true;
 }
 
-void HiPassInit(float sample_frec, float cut_frec, filter_order_t order){
-    float f = cut_frec / sample_frec;
-    hp_order = order;
-    switch(hp_order){
-        case ORDER_2:
-            dsps_biquad_gen_hpf_f32(hp2_sos_coeff, f, ORDER2_Q);
-        break;
-        case ORDER_4:
-            dsps_biquad_gen_hpf_f32(hp2_sos_coeff, f, ORDER4_Q1);
-            dsps_biquad_gen_hpf_f32(hp4_sos_coeff, f, ORDER4_Q2);
-        break;
-        case ORDER_6:
-            dsps_biquad_gen_hpf_f32(hp2_sos_coeff, f, ORDER6_Q1);
-            dsps_biquad_gen_hpf_f32(hp4_sos_coeff, f, ORDER6_Q2);
-            dsps_biquad_gen_hpf_f32(hp6_sos_coeff, f, ORDER6_Q3);
-        break;
-        case ORDER_8:
-            dsps_biquad_gen_hpf_f32(hp2_sos_coeff, f, ORDER8_Q1);
-            dsps_biquad_gen_hpf_f32(hp4_sos_coeff, f, ORDER8_Q2);
-            dsps_biquad_gen_hpf_f32(hp6_sos_coeff, f, ORDER8_Q3);
-            dsps_biquad_gen_hpf_f32(hp8_sos_coeff, f, ORDER8_Q4);
-        break;
+bool IirFilterInitCoeffs(iir_filter_t *filter, const float *coeffs, uint8_t n_sections, uint8_t channels){
+    if(!IirFilterAlloc(filter, n_sections, channels)){
+        return false;
     }
+    memcpy(filter->coeffs, coeffs, n_sections * IIR_SOS_COEFFS * sizeof(float));
+    return true;
 }
 
-void LowPassFilter(float * input_signal, float * output_signal, int16_t signal_lenght){
-    switch(lp_order){
-        case ORDER_2:
-            dsps_biquad_f32(input_signal, output_signal, signal_lenght, lp2_sos_coeff, lp2_delay);
-        break;
-        case ORDER_4:
-            dsps_biquad_f32(input_signal, output_signal, signal_lenght, lp2_sos_coeff, lp2_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, lp4_sos_coeff, lp4_delay);
-        break;
-        case ORDER_6:
-            dsps_biquad_f32(input_signal, output_signal, signal_lenght, lp2_sos_coeff, lp2_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, lp4_sos_coeff, lp4_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, lp6_sos_coeff, lp6_delay);
-        break;
-        case ORDER_8:
-            dsps_biquad_f32(input_signal, output_signal, signal_lenght, lp2_sos_coeff, lp2_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, lp4_sos_coeff, lp4_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, lp6_sos_coeff, lp6_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, lp8_sos_coeff, lp8_delay);
-        break;
+bool IirFilterSetCoeffs(iir_filter_t *filter, const float *coeffs, uint8_t n_sections){
+    if(n_sections != filter->n_sections){
+        return false;
     }
+    memcpy(filter->coeffs, coeffs, n_sections * IIR_SOS_COEFFS * sizeof(float));
+    return true;
 }
 
-void HiPassFilter(float * input_signal, float * output_signal, int16_t signal_lenght){
-    switch(hp_order){
-        case ORDER_2:
-            dsps_biquad_f32(input_signal, output_signal, signal_lenght, hp2_sos_coeff, hp2_delay);
-        break;
-        case ORDER_4:
-            dsps_biquad_f32(input_signal, output_signal, signal_lenght, hp2_sos_coeff, hp2_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, hp4_sos_coeff, hp4_delay);
-        break;
-        case ORDER_6:
-            dsps_biquad_f32(input_signal, output_signal, signal_lenght, hp2_sos_coeff, hp2_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, hp4_sos_coeff, hp4_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, hp6_sos_coeff, hp6_delay);
-        break;
-        case ORDER_8:
-            dsps_biquad_f32(input_signal, output_signal, signal_lenght, hp2_sos_coeff, hp2_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, hp4_sos_coeff, hp4_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, hp6_sos_coeff, hp6_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, hp8_sos_coeff, hp8_delay);
-        break;
+void IirFilterDeinit(iir_filter_t *filter){
+    free(filter->coeffs);
+    free(filter->delay);
+    filter->coeffs = NULL;
+    filter->delay = NULL;
+    filter->n_sections = 0;
+    filter->n_channels = 0;
+}
+
+void IirFilterReset(iir_filter_t *filter){
+    memset(filter->delay, 0, filter->n_channels * filter->n_sections * IIR_SOS_DELAY * sizeof(float));
+}
+
+void IirFilterApply(iir_filter_t *filter, uint8_t channel, float * input_signal, float * output_signal, uint16_t signal_lenght){
+    float *delay = &filter->delay[channel * filter->n_sections * IIR_SOS_DELAY];
+    if(filter->n_sections == 0){
+        return;
     }
+    // All the sections in a single pass over the signal
+    dsps_biquad_sos_f32(input_signal, output_signal, signal_lenght, filter->coeffs, delay, filter->n_sections);
+}
+
+void IirFilterApplyInterleaved(iir_filter_t *filter, float * input_signal, float * output_signal, uint16_t signal_lenght){
+    uint32_t n_samples = (uint32_t)signal_lenght * filter->n_channels;
+    uint16_t channel_delay = filter->n_sections * IIR_SOS_DELAY;
+    float *w;
+    for(uint32_t i = 0; i < n_samples; i += filter->n_channels){
+        w = filter->delay;
+        for(uint8_t ch = 0; ch < filter->n_channels; ch++){
+            // Each sample goes trough all the sections before the next one is read
+            output_signal[i + ch] = SosSample(filter->coeffs, w, filter->n_sections, input_signal[i + ch]);
+            w += channel_delay;
+        }
+    }
+}
+
+void IirFilterZeroPhase(iir_filter_t *filter, uint8_t channel, float * signal, uint16_t signal_lenght){
+    float *w = &filter->delay[channel * filter->n_sections * IIR_SOS_DELAY];
+    float pad[IIR_ZERO_PHASE_MAX_PAD];
+    uint16_t pad_lenght = 3 * (2 * filter->n_sections + 1);
+    if((filter->n_sections == 0) || (signal_lenght == 0)){
+        return;
+    }
+    if(pad_lenght > IIR_ZERO_PHASE_MAX_PAD){
+        pad_lenght = IIR_ZERO_PHASE_MAX_PAD;
+    }
+    if(pad_lenght > signal_lenght - 1){
+        pad_lenght = signal_lenght - 1;
+    }
+    // Forward: odd extension at the start (2 * x[0] - x[k]), calculated on the fly, with the
+    // filter starting in steady state for its first sample
+    SosSteadyState(filter->coeffs, w, filter->n_sections, 2 * signal[0] - signal[pad_lenght]);
+    for(uint16_t k = pad_lenght; k > 0; k--){
+        SosSample(filter->coeffs, w, filter->n_sections, 2 * signal[0] - signal[k]);
+    }
+    // Odd extension at the end, its output is kept to start the backward pass
+    for(uint16_t k = 1; k <= pad_lenght; k++){
+        pad[k - 1] = 2 * signal[signal_lenght - 1] - signal[signal_lenght - 1 - k];
+    }
+    dsps_biquad_sos_f32(signal, signal, signal_lenght, filter->coeffs, w, filter->n_sections);
+    for(uint16_t k = 0; k < pad_lenght; k++){
+        pad[k] = SosSample(filter->coeffs, w, filter->n_sections, pad[k]);
+    }
+    // Backward, over the same array from the end
+    SosSteadyState(filter->coeffs, w, filter->n_sections, (pad_lenght > 0) ? pad[pad_lenght - 1] : signal[signal_lenght - 1]);
+    for(int16_t k = pad_lenght - 1; k >= 0; k--){
+        SosSample(filter->coeffs, w, filter->n_sections, pad[k]);
+    }
+    for(int32_t i = signal_lenght - 1; i >= 0; i--){
+        signal[i] = SosSample(filter->coeffs, w, filter->n_sections, signal[i]);
+    }
+    memset(w, 0, filter->n_sections * IIR_SOS_DELAY * sizeof(float));
+}
+
+void LowPassInit(float sample_frec, float cut_frec, filter_order_t order){
+    IirFilterDeinit(&lp_filter);
+    IirFilterInit(&lp_filter, IIR_LOW_PASS, sample_frec, cut_frec, order, 1);
+}
+
+void HiPassInit(float sample_frec, float cut_frec, filter_order_t order){
+    IirFilterDeinit(&hp_filter);
+    IirFilterInit(&hp_filter, IIR_HI_PASS, sample_frec, cut_frec, order, 1);
+}
+
+void LowPassFilter(float * input_signal, float * output_signal, int16_t signal_lenght){
+    IirFilterApply(&lp_filter, 0, input_signal, output_signal, signal_lenght);
+}
+
+void HiPassFilter(float * input_signal, float * output_signal, int16_t signal_lenght){
+    IirFilterApply(&hp_filter, 0, input_signal, output_signal, signal_lenght);
 }
 
-/*==================[end of file]============================================*/
\ No newline at end of file
+/*==================[end of file]============================================*/
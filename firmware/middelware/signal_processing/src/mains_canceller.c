@@ -0,0 +1,150 @@
+/**
+ * @file mains_canceller.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "mains_canceller.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Correct the frequency of the reference with the rotation of the weights since the last call
+ * 
+ * With an interference at f + df the weights rotate -2 * pi * df radians per sample. The error is
+ * also accumulated as the drift of the frequency (second order loop), so a frequency that keeps
+ * changing is followed without lag.
+ */
+static void MainsTrack(mains_canceller_t *canceller){
+    float *w = canceller->weights;
+    float *last = canceller->last;
+    float cross = last[0] * w[1] - last[1] * w[0];
+    float dot = last[0] * w[0] + last[1] * w[1];
+    float frec = canceller->ref.freq;
+    float max = canceller->nominal * MAINS_MAX_DEVIATION;
+    float error = 0;
+    if(dot != 0 || cross != 0){
+        error = -atan2f(cross, dot) / (2 * M_PI * canceller->period);
+    }
+    canceller->drift += MAINS_DRIFT_GAIN * error;
+    frec += MAINS_TRACK_GAIN * error + canceller->drift;
+    if(frec > canceller->nominal + max){
+        frec = canceller->nominal + max;
+    }
+    if(frec < canceller->nominal - max){
+        frec = canceller->nominal - max;
+    }
+    canceller->ref.freq = frec;
+    last[0] = w[0];
+    last[1] = w[1];
+    canceller->count = 0;
+}
+
+/*==================[external functions definition]==========================*/
+bool MainsCancellerInit(mains_canceller_t *canceller, float sample_frec, float mains_frec, float bandwidth){
+    if((sample_frec <= 0) || (mains_frec <= 0) || (mains_frec * (1 + MAINS_MAX_DEVIATION) >= sample_frec / 2) || (bandwidth <= 0)){
+        return false;
+    }
+    canceller->sample_frec = sample_frec;
+    canceller->nominal = mains_frec / sample_frec;
+    // -3 dB bandwidth of the notch is step * sample_frec / (2 * pi)
+    canceller->step = 2 * M_PI * bandwidth / sample_frec;
+    canceller->period = MAINS_TRACK_PERIOD * sample_frec;
+    if(canceller->period == 0){
+        canceller->period = 1;
+    }
+    canceller->buffer = (float *)malloc(2 * MAINS_BLOCK * sizeof(float));
+    if(canceller->buffer == NULL){
+        return false;
+    }
+    if(dsps_cplx_gen_init(&canceller->ref, F32_FLOAT, NULL, MAINS_LUT_LENGHT, canceller->nominal, 0) != ESP_OK){
+        free(canceller->buffer);
+        canceller->buffer = NULL;
+        return false;
+    }
+    MainsCancellerReset(canceller);
+    return true;
+}
+
+void MainsCancellerDeinit(mains_canceller_t *canceller){
+    if(canceller->buffer != NULL){
+        cplx_gen_free(&canceller->ref);
+    }
+    free(canceller->buffer);
+    canceller->buffer = NULL;
+}
+
+void MainsCancellerReset(mains_canceller_t *canceller){
+    memset(canceller->weights, 0, sizeof(canceller->weights));
+    memset(canceller->last, 0, sizeof(canceller->last));
+    canceller->count = 0;
+    canceller->drift = 0;
+    canceller->ref.freq = canceller->nominal;
+    canceller->ref.phase = 0;
+}
+
+void MainsCancellerProcess(mains_canceller_t *canceller, const float * input_signal, float * output_signal, uint16_t signal_lenght){
+    float *ref = canceller->buffer;
+    float w0 = canceller->weights[0];
+    float w1 = canceller->weights[1];
+    float step = canceller->step;
+    float e;
+    uint16_t n;
+    while(signal_lenght > 0){
+        // Up to the end of the reference block or of the tracking period
+        n = canceller->period - canceller->count;
+        if(n > MAINS_BLOCK){
+            n = MAINS_BLOCK;
+        }
+        if(n > signal_lenght){
+            n = signal_lenght;
+        }
+        // The ANSI version is used on every target, and it doesn't keep the phase between calls
+        dsps_cplx_gen_ansi(&canceller->ref, ref, n);
+        canceller->ref.phase += n * canceller->ref.freq;
+        canceller->ref.phase -= floorf(canceller->ref.phase);
+        for(uint16_t i = 0; i < n; i++){
+            e = input_signal[i] - (w0 * ref[2 * i] + w1 * ref[2 * i + 1]);
+            output_signal[i] = e;
+            e *= step;
+            w0 += e * ref[2 * i];
+            w1 += e * ref[2 * i + 1];
+        }
+        canceller->weights[0] = w0;
+        canceller->weights[1] = w1;
+        canceller->count += n;
+        if(canceller->count >= canceller->period){
+            MainsTrack(canceller);
+        }
+        input_signal += n;
+        output_signal += n;
+        signal_lenght -= n;
+    }
+}
+
+float MainsCancellerFrequency(mains_canceller_t *canceller){
+    return canceller->ref.freq * canceller->sample_frec;
+}
+
+float MainsCancellerAmplitude(mains_canceller_t *canceller){
+    return sqrtf(canceller->weights[0] * canceller->weights[0] + canceller->weights[1] * canceller->weights[1]);
+}
+
+/*==================[end of file]============================================*/
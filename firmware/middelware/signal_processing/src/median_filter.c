@@ -0,0 +1,186 @@
+/**
+ * @file median_filter.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "median_filter.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Position of the first sorted value not less than x (binary search)
+ */
+static uint16_t LowerBound(const float *sorted, uint16_t count, float x){
+    uint16_t first = 0;
+    uint16_t half;
+    while(count > 0){
+        half = count / 2;
+        if(sorted[first + half] < x){
+            first += half + 1;
+            count -= half + 1;
+        }
+        else{
+            count = half;
+        }
+    }
+    return first;
+}
+
+/**
+ * @brief Add a sample to the window (replacing the oldest one once it is full) and keep it sorted
+ */
+static void MedianPush(median_filter_t *filter, float x){
+    float *sorted = filter->sorted;
+    uint16_t old, pos;
+    if(filter->count < filter->lenght){
+        pos = LowerBound(sorted, filter->count, x);
+        memmove(&sorted[pos + 1], &sorted[pos], (filter->count - pos) * sizeof(float));
+        sorted[pos] = x;
+        filter->count++;
+    }
+    else{
+        // Only the values between the oldest sample and the new one are moved
+        old = LowerBound(sorted, filter->count, filter->window[filter->pos]);
+        pos = LowerBound(sorted, filter->count, x);
+        if(pos > old){
+            memmove(&sorted[old], &sorted[old + 1], (pos - 1 - old) * sizeof(float));
+            sorted[pos - 1] = x;
+        }
+        else{
+            memmove(&sorted[pos + 1], &sorted[pos], (old - pos) * sizeof(float));
+            sorted[pos] = x;
+        }
+    }
+    filter->window[filter->pos] = x;
+    if(++filter->pos == filter->lenght){
+        filter->pos = 0;
+    }
+}
+
+/**
+ * @brief Median of the window
+ */
+static float MedianValue(median_filter_t *filter){
+    uint16_t mid = filter->count / 2;
+    if(filter->count % 2){
+        return filter->sorted[mid];
+    }
+    return (filter->sorted[mid - 1] + filter->sorted[mid]) / 2;
+}
+
+/**
+ * @brief Median absolute deviation of the window from its median
+ * 
+ * The deviations of the samples under and over the median are both sorted, going away from the
+ * middle of the window, so they are merged up to the middle rank.
+ */
+static float MedianDeviation(median_filter_t *filter, float median){
+    const float *sorted = filter->sorted;
+    int32_t low = (filter->count - 1) / 2;
+    int32_t high = low + 1;
+    float deviation = 0, previous = 0;
+    for(uint16_t rank = 0; rank <= filter->count / 2; rank++){
+        previous = deviation;
+        if((high >= filter->count) || ((low >= 0) && (median - sorted[low] <= sorted[high] - median))){
+            deviation = median - sorted[low--];
+        }
+        else{
+            deviation = sorted[high++] - median;
+        }
+    }
+    if(filter->count % 2){
+        return deviation;
+    }
+    return (previous + deviation) / 2;
+}
+
+/*==================[external functions definition]==========================*/
+bool MedianFilterInit(median_filter_t *filter, uint16_t lenght){
+    if(lenght == 0){
+        return false;
+    }
+    filter->lenght = lenght;
+    filter->window = (float *)malloc(lenght * sizeof(float));
+    filter->sorted = (float *)malloc(lenght * sizeof(float));
+    if((filter->window == NULL) || (filter->sorted == NULL)){
+        MedianFilterDeinit(filter);
+        return false;
+    }
+    MedianFilterReset(filter);
+    return true;
+}
+
+void MedianFilterDeinit(median_filter_t *filter){
+    free(filter->window);
+    free(filter->sorted);
+    filter->window = NULL;
+    filter->sorted = NULL;
+    filter->lenght = 0;
+}
+
+void MedianFilterReset(median_filter_t *filter){
+    filter->pos = 0;
+    filter->count = 0;
+}
+
+void MedianFilterProcess(median_filter_t *filter, const float * input_signal, float * output_signal, uint16_t signal_lenght){
+    for(uint16_t i = 0; i < signal_lenght; i++){
+        MedianPush(filter, input_signal[i]);
+        output_signal[i] = MedianValue(filter);
+    }
+}
+
+bool HampelFilterInit(hampel_filter_t *filter, uint16_t lenght, float threshold){
+    if(threshold < 0){
+        return false;
+    }
+    filter->threshold = threshold;
+    filter->outliers = 0;
+    return MedianFilterInit(&filter->median, lenght);
+}
+
+void HampelFilterDeinit(hampel_filter_t *filter){
+    MedianFilterDeinit(&filter->median);
+}
+
+void HampelFilterReset(hampel_filter_t *filter){
+    MedianFilterReset(&filter->median);
+    filter->outliers = 0;
+}
+
+uint16_t HampelFilterProcess(hampel_filter_t *filter, const float * input_signal, float * output_signal, uint16_t signal_lenght){
+    uint16_t outliers = 0;
+    float x, median;
+    for(uint16_t i = 0; i < signal_lenght; i++){
+        x = input_signal[i];
+        MedianPush(&filter->median, x);
+        median = MedianValue(&filter->median);
+        if(fabsf(x - median) > filter->threshold * HAMPEL_MAD_SCALE * MedianDeviation(&filter->median, median)){
+            x = median;
+            outliers++;
+        }
+        output_signal[i] = x;
+    }
+    filter->outliers += outliers;
+    return outliers;
+}
+
+/*==================[end of file]============================================*/
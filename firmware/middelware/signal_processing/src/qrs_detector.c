@@ -0,0 +1,302 @@
+/**
+ * @file qrs_detector.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "qrs_detector.h"
+#include "filter_design.h"
+/*==================[macros and definitions]=================================*/
+#define BAND_PASS_ORDER     2       /*!< Order of the high pass and low pass parts of the band pass filter */
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Phase of a cascade of second order sections at w radians per sample
+ */
+static float SosPhase(const float *coeffs, uint8_t n_sections, float w){
+    float phase = 0;
+    for(uint8_t k = 0; k < n_sections; k++){
+        const float *c = &coeffs[k * IIR_SOS_COEFFS];
+        phase += atan2f(-c[1] * sinf(w) - c[2] * sinf(2 * w), c[0] + c[1] * cosf(w) + c[2] * cosf(2 * w));
+        phase -= atan2f(-c[3] * sinf(w) - c[4] * sinf(2 * w), 1 + c[3] * cosf(w) + c[4] * cosf(2 * w));
+    }
+    return phase;
+}
+
+/**
+ * @brief Group delay of the band pass filter at its center frequency (samples)
+ */
+static float BandPassDelay(qrs_detector_t *detector){
+    float w = 2 * M_PI * sqrtf(QRS_LOW_FREC * QRS_HIGH_FREC) / detector->sample_frec;
+    float dw = w / 100;
+    float dphase = SosPhase(detector->band_pass.coeffs, detector->band_pass.n_sections, w + dw)
+        - SosPhase(detector->band_pass.coeffs, detector->band_pass.n_sections, w - dw);
+    while(dphase > M_PI){
+        dphase -= 2 * M_PI;
+    }
+    while(dphase < -M_PI){
+        dphase += 2 * M_PI;
+    }
+    return -dphase / (2 * dw);
+}
+
+/**
+ * @brief Input sample at a given sample number (it must be in ring)
+ */
+static float RingSample(qrs_detector_t *detector, uint32_t sample){
+    int32_t pos = detector->ring_pos - (int32_t)(detector->samples + 1 - sample);
+    if(pos < 0){
+        pos += detector->ring_lenght;
+    }
+    return detector->ring[pos];
+}
+
+/**
+ * @brief Report a beat and update the RR intervals
+ */
+static void QrsBeat(qrs_detector_t *detector, uint32_t r, float slope){
+    qrs_beat_t beat;
+    uint32_t rr;
+    if(detector->beats > 0){
+        rr = r - detector->last_r;
+        detector->rr_sum += rr - detector->rr[detector->beats % QRS_RR_AVERAGE];
+        detector->rr[detector->beats % QRS_RR_AVERAGE] = rr;
+        detector->heart_rate = 60 * detector->sample_frec / rr;
+    }
+    detector->last_r = r;
+    detector->last_slope = slope;
+    detector->candidate = 0;
+    detector->beats++;
+    if(detector->func_p != NULL){
+        beat.sample = r;
+        beat.heart_rate = detector->heart_rate;
+        detector->func_p(&beat, detector->param_p);
+    }
+}
+
+/**
+ * @brief New threshold from the signal and noise levels
+ */
+static void QrsThreshold(qrs_detector_t *detector){
+    detector->threshold = detector->noise_level + 0.25 * (detector->signal_level - detector->noise_level);
+}
+
+/**
+ * @brief Classify the current peak of the integrated signal as QRS or noise
+ * 
+ * @return true     Beat detected
+ */
+static bool QrsPeak(qrs_detector_t *detector){
+    float peak = detector->peak;
+    float value, previous, mean = 0, max = 0, slope = 0;
+    uint32_t r = detector->peak_sample;
+    // The QRS is in the integration window before the peak of the integrated signal (plus the delay
+    // of the filters). The R peak is the largest deviation from the mean of the input signal there,
+    // which doesn't depend on the polarity of the lead nor on the shape of the filtered QRS.
+    uint32_t first = detector->peak_sample - detector->window_lenght - detector->delay - QRS_DERIVATIVE_LENGHT;
+    for(uint32_t i = first; i <= detector->peak_sample; i++){
+        mean += RingSample(detector, i);
+    }
+    mean /= detector->peak_sample - first + 1;
+    previous = RingSample(detector, first);
+    for(uint32_t i = first + 1; i <= detector->peak_sample; i++){
+        value = RingSample(detector, i);
+        if(fabsf(value - mean) > max){
+            max = fabsf(value - mean);
+            r = i;
+        }
+        if(fabsf(value - previous) > slope){
+            slope = fabsf(value - previous);
+        }
+        previous = value;
+    }
+    if((detector->beats > 0) && ((int32_t)(r - detector->last_r) < detector->refractory)){
+        return false;
+    }
+    if(peak > detector->threshold){
+        if((detector->beats == 0) || ((int32_t)(r - detector->last_r) >= detector->t_wave) || (slope >= detector->last_slope / 2)){
+            detector->signal_level = 0.125 * peak + 0.875 * detector->signal_level;
+            QrsThreshold(detector);
+            QrsBeat(detector, r, slope);
+            return true;
+        }
+    }
+    // Noise peak or T wave
+    detector->noise_level = 0.125 * peak + 0.875 * detector->noise_level;
+    QrsThreshold(detector);
+    if(peak > detector->candidate){
+        detector->candidate = peak;
+        detector->candidate_r = r;
+        detector->candidate_slope = slope;
+    }
+    return false;
+}
+
+/*==================[external functions definition]==========================*/
+bool QrsDetectorInit(qrs_detector_t *detector, float sample_frec, void (*func_p)(qrs_beat_t *beat, void *param_p), void *param_p){
+    float coeffs[2 * IIR_SOS_COEFFS];
+    uint8_t n_sections = DesignIirSections(DESIGN_BAND_PASS, BAND_PASS_ORDER);
+    if(sample_frec <= 2 * QRS_HIGH_FREC){
+        return false;
+    }
+    detector->sample_frec = sample_frec;
+    detector->func_p = func_p;
+    detector->param_p = param_p;
+    detector->window_lenght = QRS_WINDOW * sample_frec;
+    detector->hold = QRS_HOLD * sample_frec;
+    detector->refractory = QRS_REFRACTORY * sample_frec;
+    detector->t_wave = QRS_T_WAVE * sample_frec;
+    detector->learn = QRS_LEARN * sample_frec;
+    detector->buffer = (float *)malloc(QRS_BLOCK * sizeof(float));
+    detector->ring = NULL;
+    detector->window = (float *)malloc(detector->window_lenght * sizeof(float));
+    detector->band_pass.coeffs = NULL;
+    detector->band_pass.delay = NULL;
+    if((detector->buffer == NULL) || (detector->window == NULL) ||
+        !DesignIir(coeffs, DESIGN_BUTTERWORTH, DESIGN_BAND_PASS, sample_frec, QRS_LOW_FREC, QRS_HIGH_FREC, BAND_PASS_ORDER, 0) ||
+        !IirFilterInitCoeffs(&detector->band_pass, coeffs, n_sections, 1)){
+        QrsDetectorDeinit(detector);
+        return false;
+    }
+    detector->delay = ceilf(BandPassDelay(detector));
+    detector->ring_lenght = detector->hold + detector->window_lenght + detector->delay + QRS_DERIVATIVE_LENGHT + 2;
+    detector->ring = (float *)malloc(detector->ring_lenght * sizeof(float));
+    if(detector->ring == NULL){
+        QrsDetectorDeinit(detector);
+        return false;
+    }
+    QrsDetectorReset(detector);
+    return true;
+}
+
+void QrsDetectorDeinit(qrs_detector_t *detector){
+    IirFilterDeinit(&detector->band_pass);
+    free(detector->buffer);
+    free(detector->ring);
+    free(detector->window);
+    detector->buffer = NULL;
+    detector->ring = NULL;
+    detector->window = NULL;
+}
+
+void QrsDetectorReset(qrs_detector_t *detector){
+    IirFilterReset(&detector->band_pass);
+    memset(detector->ring, 0, detector->ring_lenght * sizeof(float));
+    memset(detector->window, 0, detector->window_lenght * sizeof(float));
+    memset(detector->filtered, 0, sizeof(detector->filtered));
+    memset(detector->rr, 0, sizeof(detector->rr));
+    detector->ring_pos = 0;
+    detector->window_pos = 0;
+    detector->window_sum = 0;
+    detector->integrated = 0;
+    detector->samples = 0;
+    detector->peak = 0;
+    detector->signal_level = 0;
+    detector->noise_level = 0;
+    detector->threshold = 0;
+    detector->candidate = 0;
+    detector->last_r = 0;
+    detector->last_slope = 0;
+    detector->beats = 0;
+    detector->rr_sum = 0;
+    detector->heart_rate = 0;
+}
+
+uint16_t QrsDetectorProcess(qrs_detector_t *detector, const float *samples, uint32_t n_samples){
+    uint16_t beats = 0;
+    uint16_t n;
+    float x, d, integrated;
+    float *y = detector->filtered;
+    while(n_samples > 0){
+        n = (n_samples > QRS_BLOCK) ? QRS_BLOCK : n_samples;
+        memcpy(detector->buffer, samples, n * sizeof(float));
+        IirFilterApply(&detector->band_pass, 0, detector->buffer, detector->buffer, n);
+        for(uint16_t i = 0; i < n; i++){
+            detector->ring[detector->ring_pos] = samples[i];
+            if(++detector->ring_pos == detector->ring_lenght){
+                detector->ring_pos = 0;
+            }
+            // Derivative: (2 x[n] + x[n-1] - x[n-3] - 2 x[n-4]) / 8, squared
+            x = detector->buffer[i];
+            d = 2 * x + y[0] - y[2] - 2 * y[3];
+            d = d * d / 64;
+            y[3] = y[2];
+            y[2] = y[1];
+            y[1] = y[0];
+            y[0] = x;
+            // Moving window integration, the sum is recalculated on each lap to avoid rounding drift
+            detector->window_sum += d - detector->window[detector->window_pos];
+            detector->window[detector->window_pos] = d;
+            if(++detector->window_pos == detector->window_lenght){
+                detector->window_pos = 0;
+                detector->window_sum = 0;
+                for(uint16_t j = 0; j < detector->window_lenght; j++){
+                    detector->window_sum += detector->window[j];
+                }
+            }
+            integrated = detector->window_sum / detector->window_lenght;
+            if(detector->samples < detector->learn){
+                // Learning: signal level is the maximum and noise level the mean of the integrated signal
+                if(integrated > detector->signal_level){
+                    detector->signal_level = integrated;
+                }
+                detector->noise_level += integrated / detector->learn;
+                if(detector->samples + 1 == detector->learn){
+                    detector->signal_level /= 3;
+                    detector->noise_level /= 2;
+                    QrsThreshold(detector);
+                }
+            }
+            else if(detector->peak > 0){
+                // A peak is taken when there is no larger value for hold samples
+                if(integrated > detector->peak){
+                    detector->peak = integrated;
+                    detector->peak_sample = detector->samples;
+                }
+                else if(detector->samples - detector->peak_sample >= detector->hold){
+                    beats += QrsPeak(detector);
+                    detector->peak = 0;
+                }
+            }
+            else if(integrated > detector->integrated){
+                detector->peak = integrated;
+                detector->peak_sample = detector->samples;
+            }
+            // Search back with half the threshold
+            if((detector->beats > QRS_RR_AVERAGE) && (detector->candidate > detector->threshold / 2) &&
+                (detector->samples - detector->last_r > 1.66 * detector->rr_sum / QRS_RR_AVERAGE)){
+                detector->signal_level = 0.25 * detector->candidate + 0.75 * detector->signal_level;
+                QrsThreshold(detector);
+                QrsBeat(detector, detector->candidate_r, detector->candidate_slope);
+                beats++;
+            }
+            detector->integrated = integrated;
+            detector->samples++;
+        }
+        samples += n;
+        n_samples -= n;
+    }
+    return beats;
+}
+
+float QrsDetectorHeartRate(qrs_detector_t *detector){
+    return detector->heart_rate;
+}
+
+/*==================[end of file]============================================*/
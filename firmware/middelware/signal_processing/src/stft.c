@@ -0,0 +1,107 @@
+/**
+ * @file stft.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdlib.h>
+#include <string.h>
+#include "stft.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+bool StftInit(stft_t *stft, uint16_t lenght, uint16_t hop, fft_window_t window, void (*func_p)(float *frame, void *param_p), void *param_p){
+    if((hop == 0) || (hop > lenght)){
+        return false;
+    }
+    // The plan checks the lenght, and is initialized first so StftDeinit() can always free it
+    if(!FFTPlanInit(&stft->plan, lenght, window)){
+        return false;
+    }
+    stft->lenght = lenght;
+    stft->hop = hop;
+    stft->window = window;
+    stft->func_p = func_p;
+    stft->param_p = param_p;
+    stft->ring = (float *)malloc(2 * lenght * sizeof(float));
+    stft->frame = (float *)calloc(lenght / 2, sizeof(float));
+    if((stft->ring == NULL) || (stft->frame == NULL)){
+        StftDeinit(stft);
+        return false;
+    }
+    StftReset(stft);
+    return true;
+}
+
+void StftDeinit(stft_t *stft){
+    FFTPlanDeinit(&stft->plan);
+    free(stft->ring);
+    free(stft->frame);
+    stft->ring = NULL;
+    stft->frame = NULL;
+    stft->lenght = 0;
+}
+
+void StftReset(stft_t *stft){
+    memset(stft->ring, 0, 2 * stft->lenght * sizeof(float));
+    stft->pos = 0;
+    stft->to_next = stft->lenght;
+    stft->frames = 0;
+}
+
+uint16_t StftProcess(stft_t *stft, const float *samples, uint32_t n_samples){
+    uint16_t frames = 0;
+    uint32_t n;
+    while(n_samples > 0){
+        // Copy up to the next frame or the end of the ring, whichever comes first
+        n = stft->to_next;
+        if(n > (uint32_t)(stft->lenght - stft->pos)){
+            n = stft->lenght - stft->pos;
+        }
+        if(n > n_samples){
+            n = n_samples;
+        }
+        memcpy(&stft->ring[stft->pos], samples, n * sizeof(float));
+        memcpy(&stft->ring[stft->pos + stft->lenght], samples, n * sizeof(float));
+        stft->pos += n;
+        if(stft->pos == stft->lenght){
+            stft->pos = 0;
+        }
+        stft->to_next -= n;
+        samples += n;
+        n_samples -= n;
+        if(stft->to_next == 0){
+            // ring[pos] is the oldest sample, the frame is ring[pos .. pos + lenght - 1]
+            FFTPlanSpectrum(&stft->plan, &stft->ring[stft->pos], stft->frame, FFT_MAGNITUDE);
+            stft->to_next = stft->hop;
+            stft->frames++;
+            frames++;
+            if(stft->func_p != NULL){
+                stft->func_p(stft->frame, stft->param_p);
+            }
+        }
+    }
+    return frames;
+}
+
+float * StftFrame(stft_t *stft){
+    return stft->frame;
+}
+
+/*==================[end of file]============================================*/
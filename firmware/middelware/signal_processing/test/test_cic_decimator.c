@@ -0,0 +1,170 @@
+/**
+ * @file test_cic_decimator.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief Unity tests of the CIC decimator module
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include "unity.h"
+#include "esp_log.h"
+
+#include "dsp_common.h"
+#include "dsp_tests.h"
+#include "esp_dsp.h"
+#include "cic_decimator.h"
+#include "filter_design.h"
+
+static const char *TAG = "cic_decimator";
+
+#define FS          32000
+#define DECIM       16
+#define STAGES      5
+#define FIR_DECIM   2
+#define FIR_TAPS    48          // Multiple of 4 for the ESP32-S3
+#define FS_OUT      (FS / (DECIM * FIR_DECIM))
+#define PASS_BAND   250         // Flat band, aliases from [FS_OUT - PASS_BAND, FS_OUT + PASS_BAND] are rejected
+#define ATTENUATION 80
+#define BLOCK       128         // ADC_BLOCK_SIZE of analog_io_mcu
+#define SIG_LEN     (1024 * DECIM * FIR_DECIM)
+#define OUT_LEN     (SIG_LEN / (DECIM * FIR_DECIM))
+#define SETTLE      32          // Output samples skipped while the filters settle
+#define OFFSET      1650        // mV
+
+static uint16_t signal[SIG_LEN];
+static float output[OUT_LEN + 1];
+
+// Sinusoid in mV as read from the ADC (rounded, with dither so the rounding error is noise)
+static void gen_tone(float frec, float amplitude)
+{
+    for (int i = 0 ; i < SIG_LEN ; i++) {
+        float dither = (float)rand() / RAND_MAX - (float)rand() / RAND_MAX;
+        signal[i] = (uint16_t)lroundf(OFFSET + amplitude * sinf(2 * M_PI * frec * i / FS) + dither);
+    }
+}
+
+// Decimate in ADC blocks
+static int decimate(cic_decimator_t *cic)
+{
+    int n = 0;
+    for (int i = 0 ; i < SIG_LEN ; i += BLOCK) {
+        n += CicDecimatorProcess(cic, &signal[i], &output[n], BLOCK);
+    }
+    return n;
+}
+
+// Amplitude of the output at the frequency where frec is aliased
+static float tone_amplitude(float frec, int n)
+{
+    float alias = fmodf(frec, FS_OUT);
+    if (alias > FS_OUT / 2) {
+        alias = FS_OUT - alias;
+    }
+    float re = 0, im = 0;
+    for (int i = SETTLE ; i < n ; i++) {
+        re += (output[i] - OFFSET) * cosf(2 * M_PI * alias * i / FS_OUT);
+        im += (output[i] - OFFSET) * sinf(2 * M_PI * alias * i / FS_OUT);
+    }
+    return 2 * sqrtf(re * re + im * im) / (n - SETTLE);
+}
+
+TEST_CASE("CIC decimator functionality", "[cic]")
+{
+    cic_decimator_t cic;
+    // Invalid stages, accumulator overflow and cut-off over the Nyquist frequency of the CIC output
+    TEST_ASSERT_FALSE(CicDecimatorInit(&cic, FS, DECIM, CIC_MAX_STAGES + 1, 12, FIR_DECIM, FIR_TAPS, FS_OUT / 2));
+    TEST_ASSERT_FALSE(CicDecimatorInit(&cic, FS, 64, STAGES, 12, FIR_DECIM, FIR_TAPS, FS_OUT / 2));
+    TEST_ASSERT_FALSE(CicDecimatorInit(&cic, FS, DECIM, STAGES, 12, FIR_DECIM, FIR_TAPS, FS / (2 * DECIM)));
+    TEST_ASSERT_TRUE(CicDecimatorInit(&cic, FS, DECIM, STAGES, 12, FIR_DECIM, FIR_TAPS, FS_OUT / 2));
+
+    // DC gain, with the largest input the accumulators must hold
+    for (int i = 0 ; i < SIG_LEN ; i++) {
+        signal[i] = 4095;
+    }
+    int n = decimate(&cic);
+    TEST_ASSERT_EQUAL(OUT_LEN, n);
+    for (int i = SETTLE ; i < n ; i++) {
+        TEST_ASSERT_FLOAT_WITHIN(0.01, 4095, output[i]);
+    }
+
+    // Pass band compensated to +-0.1 dB
+    float worst_pass = 0;
+    for (float f = 10 ; f <= PASS_BAND ; f += 20) {
+        CicDecimatorReset(&cic);
+        gen_tone(f, 1000);
+        n = decimate(&cic);
+        float gain = 20 * log10f(tone_amplitude(f, n) / 1000);
+        worst_pass = fmaxf(worst_pass, fabsf(gain));
+        TEST_ASSERT_FLOAT_WITHIN(0.1, 0, gain);
+    }
+
+    // Tones aliased into the pass band
+    float worst_stop = -200;
+    for (int k = 1 ; k < FS / (2 * FS_OUT) ; k++) {
+        for (float f = k * FS_OUT - PASS_BAND ; f <= k * FS_OUT + PASS_BAND ; f += 100) {
+            CicDecimatorReset(&cic);
+            gen_tone(f, 1600);
+            n = decimate(&cic);
+            float gain = 20 * log10f(tone_amplitude(f, n) / 1600);
+            worst_stop = fmaxf(worst_stop, gain);
+            TEST_ASSERT_TRUE(gain < -ATTENUATION);
+        }
+    }
+    ESP_LOGI(TAG, "Pass band ripple %.3f dB, aliases attenuated %.1f dB", worst_pass, -worst_stop);
+    CicDecimatorDeinit(&cic);
+}
+
+TEST_CASE("CIC decimator benchmark", "[cic]")
+{
+    cic_decimator_t cic;
+    TEST_ASSERT_TRUE(CicDecimatorInit(&cic, FS, DECIM, STAGES, 12, FIR_DECIM, FIR_TAPS, FS_OUT / 2));
+    gen_tone(100, 1000);
+
+    // Single stage decimator with the same pass band and attenuation, in Q15
+    int taps = DesignKaiserTaps(FS, FS_OUT - 2 * PASS_BAND, ATTENUATION);
+    float *coeffs = (float *)malloc(taps * sizeof(float));
+    int16_t *coeffs_q15 = (int16_t *)malloc(taps * sizeof(int16_t));
+    int16_t *delay = (int16_t *)calloc(taps, sizeof(int16_t));
+    int16_t *input_s16 = (int16_t *)malloc(SIG_LEN * sizeof(int16_t));
+    int16_t *output_s16 = (int16_t *)malloc(OUT_LEN * sizeof(int16_t));
+    TEST_ASSERT_NOT_NULL(output_s16);
+    TEST_ASSERT_TRUE(DesignFir(coeffs, taps, DESIGN_KAISER, DesignKaiserBeta(ATTENUATION), DESIGN_LOW_PASS, FS, FS_OUT / 2, 0));
+    for (int i = 0 ; i < taps ; i++) {
+        coeffs_q15[i] = (int16_t)lroundf(coeffs[i] * 32768);
+    }
+    for (int i = 0 ; i < SIG_LEN ; i++) {
+        input_s16[i] = signal[i];
+    }
+    fir_s16_t fir;
+    TEST_ESP_OK(dsps_fird_init_s16(&fir, coeffs_q15, delay, taps, DECIM * FIR_DECIM, 0, 0));
+
+    unsigned int start_b = dsp_get_cpu_cycle_count();
+    int n_fir = dsps_fird_s16_ansi(&fir, input_s16, output_s16, OUT_LEN);
+    unsigned int end_b = dsp_get_cpu_cycle_count();
+    int cycles_fir = end_b - start_b;
+
+    start_b = dsp_get_cpu_cycle_count();
+    int n = CicDecimatorProcess(&cic, signal, output, SIG_LEN);
+    end_b = dsp_get_cpu_cycle_count();
+    int cycles_cic = end_b - start_b;
+
+    TEST_ASSERT_EQUAL(OUT_LEN, n_fir);
+    TEST_ASSERT_EQUAL(OUT_LEN, n);
+    ESP_LOGI(TAG, "Decimation by %i, %i dB: dsps_fird_s16_ansi (%i taps) - %.2f cycles/sample, CicDecimatorProcess - %.2f cycles/sample",
+             DECIM * FIR_DECIM, ATTENUATION, taps, (float)cycles_fir / SIG_LEN, (float)cycles_cic / SIG_LEN);
+    TEST_ASSERT_EXEC_IN_RANGE(1, cycles_fir, cycles_cic);
+
+    dsps_fird_s16_aexx_free(&fir);
+    free(coeffs);
+    free(coeffs_q15);
+    free(delay);
+    free(input_s16);
+    free(output_s16);
+    CicDecimatorDeinit(&cic);
+}
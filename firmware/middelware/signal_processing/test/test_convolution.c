@@ -0,0 +1,108 @@
+/**
+ * @file test_convolution.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief Unity tests of the convolution module
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include "unity.h"
+#include "esp_log.h"
+
+#include "dsp_common.h"
+#include "dsp_tests.h"
+#include "esp_dsp.h"
+#include "convolution.h"
+
+static const char *TAG = "convolution";
+
+#define SIG_LEN     2000
+#define MAX_KERNEL  200
+
+static float signal[SIG_LEN];
+static float kernel[MAX_KERNEL];
+static float output[SIG_LEN + MAX_KERNEL];
+static float check[SIG_LEN + MAX_KERNEL];
+
+static void gen_signals(void)
+{
+    for (int i = 0 ; i < SIG_LEN ; i++) {
+        signal[i] = (float)rand() / RAND_MAX - 0.5;
+    }
+    for (int i = 0 ; i < MAX_KERNEL ; i++) {
+        kernel[i] = sinf(M_PI * i / MAX_KERNEL) * ((float)rand() / RAND_MAX - 0.5);
+    }
+}
+
+static void check_output(int len)
+{
+    float max = 0;
+    for (int i = 0 ; i < len ; i++) {
+        max = fmaxf(max, fabsf(check[i]));
+    }
+    for (int i = 0 ; i < len ; i++) {
+        if (fabsf(output[i] - check[i]) > 1e-5 * max) {
+            ESP_LOGE(TAG, "output[%i] = %f, expected = %f", i, output[i], check[i]);
+            TEST_ASSERT_FLOAT_WITHIN(1e-5 * max, check[i], output[i]);
+        }
+    }
+}
+
+TEST_CASE("Convolution functionality", "[convolution]")
+{
+    convolution_t conv;
+    int kernel_lenghts[] = {1, 8, CONV_FFT_THRESHOLD, 100, MAX_KERNEL};
+    int signal_lenghts[] = {MAX_KERNEL, 500, SIG_LEN};
+    gen_signals();
+    TEST_ASSERT_TRUE(FFTInit());
+    for (int k = 0 ; k < sizeof(kernel_lenghts) / sizeof(int) ; k++) {
+        int m = kernel_lenghts[k];
+        for (int s = 0 ; s < sizeof(signal_lenghts) / sizeof(int) ; s++) {
+            int n = signal_lenghts[s];
+            TEST_ASSERT_TRUE(ConvolutionInit(&conv, kernel, m, CONV_CONVOLUTION));
+            TEST_ASSERT_EQUAL(m >= CONV_FFT_THRESHOLD, conv.fft_lenght != 0);
+            TEST_ASSERT_TRUE(ConvolutionProcess(&conv, signal, n, output));
+            dsps_conv_f32_ansi(signal, n, kernel, m, check);
+            check_output(n + m - 1);
+            ConvolutionDeinit(&conv);
+
+            TEST_ASSERT_TRUE(ConvolutionInit(&conv, kernel, m, CONV_CORRELATION));
+            TEST_ASSERT_TRUE(ConvolutionProcess(&conv, signal, n, output));
+            dsps_corr_f32_ansi(signal, n, kernel, m, check);
+            check_output(n - m + 1);
+            TEST_ASSERT_FALSE(ConvolutionProcess(&conv, signal, m - 1, output));
+            ConvolutionDeinit(&conv);
+        }
+    }
+}
+
+TEST_CASE("Convolution benchmark", "[convolution]")
+{
+    convolution_t conv;
+    gen_signals();
+    // Template matching of a 200 samples pattern
+    for (int m = 25 ; m <= MAX_KERNEL ; m *= 2) {
+        unsigned int start_b = dsp_get_cpu_cycle_count();
+        dsps_corr_f32(signal, SIG_LEN, kernel, m, check);
+        unsigned int end_b = dsp_get_cpu_cycle_count();
+        int cycles_direct = end_b - start_b;
+
+        TEST_ASSERT_TRUE(ConvolutionInit(&conv, kernel, m, CONV_CORRELATION));
+        start_b = dsp_get_cpu_cycle_count();
+        ConvolutionProcess(&conv, signal, SIG_LEN, output);
+        end_b = dsp_get_cpu_cycle_count();
+        int cycles_conv = end_b - start_b;
+        ConvolutionDeinit(&conv);
+
+        ESP_LOGI(TAG, "Correlation of %i samples with %3i samples pattern: dsps_corr_f32 - %7i cycles, ConvolutionProcess - %7i cycles", SIG_LEN, m, cycles_direct, cycles_conv);
+        if (m >= CONV_FFT_THRESHOLD) {
+            TEST_ASSERT_EXEC_IN_RANGE(1, cycles_direct, cycles_conv);
+        }
+    }
+}
@@ -0,0 +1,64 @@
+/**
+ * @file test_fft.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief Unity tests of the FFT magnitude
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include "unity.h"
+#include "esp_log.h"
+
+#include "dsp_common.h"
+#include "dsp_tests.h"
+#include "esp_dsp.h"
+#include "fft.h"
+
+#define SIG_LEN     MAX_SIGNAL_LENGHT
+
+static float signal[SIG_LEN];
+static float fft[SIG_LEN / 2];
+static float fft_ref[SIG_LEN / 2];
+static float wind[SIG_LEN];
+static float data[2 * SIG_LEN];
+
+// FFTMagnitude() as it was calculated with a full lenght complex FFT
+static void fft_magnitude_reference(const float *x, float *y, int len)
+{
+    dsps_wind_hann_f32(wind, len);
+    memset(data, 0, 2 * len * sizeof(float));
+    dsps_mul_f32(x, wind, data, len, 1, 1, 2);
+    dsps_fft2r_fc32(data, len);
+    dsps_bit_rev_fc32(data, len);
+    dsps_cplx2reC_fc32(data, len);
+    for (int j = 0 ; j < len / 2 ; j++) {
+        y[j] = 2 * sqrtf(data[j * 2 + 0] * data[j * 2 + 0] + data[j * 2 + 1] * data[j * 2 + 1]) / (len / 2);
+    }
+    y[0] = y[0] / 2;
+}
+
+TEST_CASE("FFT magnitude against the full lenght complex FFT", "[fft]")
+{
+    TEST_ASSERT_TRUE(FFTInit());
+    for (int len = 16 ; len <= SIG_LEN ; len *= 2) {
+        // Offset (bin 0), a tone on the last bin and noise
+        for (int i = 0 ; i < len ; i++) {
+            signal[i] = 0.7 + cosf(2 * M_PI * (len / 2 - 1) * i / len) + 0.01 * ((float)rand() / RAND_MAX - 0.5);
+        }
+        fft_magnitude_reference(signal, fft_ref, len);
+        FFTMagnitude(signal, fft, len);
+        for (int j = 0 ; j < len / 2 ; j++) {
+            TEST_ASSERT_FLOAT_WITHIN(1e-5 + 1e-4 * fabsf(fft_ref[j]), fft_ref[j], fft[j]);
+        }
+        // Scale of the full lenght version: bin 0 gives the offset, bins k > 0 twice the
+        // amplitude of the tone
+        TEST_ASSERT_FLOAT_WITHIN(0.05, 0.7, fft[0]);
+        TEST_ASSERT_FLOAT_WITHIN(0.1, 2.0, fft[len / 2 - 1]);
+    }
+}
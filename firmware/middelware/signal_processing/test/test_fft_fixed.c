@@ -0,0 +1,90 @@
+/**
+ * @file test_fft_fixed.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief Unity tests of the fixed point FFT module
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include "unity.h"
+#include "esp_log.h"
+
+#include "dsp_common.h"
+#include "dsp_tests.h"
+#include "fft.h"
+#include "fft_fixed.h"
+
+static const char *TAG = "fft_fixed";
+
+static uint16_t counts[MAX_SIGNAL_LENGHT];
+static float signal[MAX_SIGNAL_LENGHT];
+static float fft_float[MAX_SIGNAL_LENGHT / 2];
+static float fft_fixed[MAX_SIGNAL_LENGHT / 2];
+
+// 12 bit ADC block: tone of the given amplitude (counts) at mid scale plus 1 count of noise
+static void gen_counts(int len, float amplitude, float freq)
+{
+    for (int i = 0 ; i < len ; i++) {
+        float x = 2048 + 100 + amplitude * sinf(2 * M_PI * freq * i) + ((float)rand() / RAND_MAX - 0.5);
+        x = roundf(x);
+        counts[i] = (x < 0) ? 0 : ((x > 4095) ? 4095 : x);
+        signal[i] = (float)counts[i] - 2048;
+    }
+}
+
+TEST_CASE("FFTFixedMagnitude accuracy against FFTMagnitudeWindow", "[fft]")
+{
+    TEST_ASSERT_TRUE(FFTInit());
+    TEST_ASSERT_TRUE(FFTFixedInit());
+    float amplitudes[4] = {2000, 200, 20, 2};
+    fft_window_t windows[3] = {FFT_HANN, FFT_BLACKMAN_HARRIS, FFT_FLAT_TOP};
+    for (int len = 256 ; len <= MAX_SIGNAL_LENGHT ; len *= 2) {
+        for (int w = 0 ; w < 3 ; w++) {
+            for (int a = 0 ; a < 4 ; a++) {
+                gen_counts(len, amplitudes[a], 0.1234);
+                FFTMagnitudeWindow(signal, fft_float, len, windows[w]);
+                FFTFixedMagnitude(counts, fft_fixed, len, windows[w]);
+                // Error referred to the tone amplitude and to a full scale tone
+                float peak = 0;
+                float max_err = 0;
+                for (int i = 0 ; i < len / 2 ; i++) {
+                    peak = fmaxf(peak, fft_float[i]);
+                    max_err = fmaxf(max_err, fabsf(fft_fixed[i] - fft_float[i]));
+                }
+                ESP_LOGI(TAG, "N = %4i, window %i, amplitude %6.1f: max error %f counts (%.1f dB below the tone, %.1f dB below full scale)",
+                         len, windows[w], amplitudes[a], max_err, 20 * log10f(peak / max_err), 20 * log10f(2048 / max_err));
+                TEST_ASSERT_TRUE(20 * log10f(2048 / max_err) > 60);
+            }
+        }
+    }
+}
+
+TEST_CASE("FFTFixedMagnitude benchmark", "[fft]")
+{
+    TEST_ASSERT_TRUE(FFTInit());
+    TEST_ASSERT_TRUE(FFTFixedInit());
+    for (int len = 256 ; len <= MAX_SIGNAL_LENGHT ; len *= 2) {
+        gen_counts(len, 1000, 0.01);
+        FFTMagnitude(signal, fft_float, len);
+        FFTFixedMagnitude(counts, fft_fixed, len, FFT_HANN);
+
+        unsigned int start_b = dsp_get_cpu_cycle_count();
+        FFTMagnitude(signal, fft_float, len);
+        unsigned int end_b = dsp_get_cpu_cycle_count();
+        int cycles_float = end_b - start_b;
+
+        start_b = dsp_get_cpu_cycle_count();
+        FFTFixedMagnitude(counts, fft_fixed, len, FFT_HANN);
+        end_b = dsp_get_cpu_cycle_count();
+        int cycles_fixed = end_b - start_b;
+
+        ESP_LOGI(TAG, "N = %4i: FFTMagnitude - %i cycles, FFTFixedMagnitude - %i cycles", len, cycles_float, cycles_fixed);
+        TEST_ASSERT_EXEC_IN_RANGE(1, 100 * len * 11, cycles_fixed);
+    }
+}
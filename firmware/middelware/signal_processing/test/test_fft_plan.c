@@ -0,0 +1,184 @@
+/**
+ * @file test_fft_plan.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief Unity tests of the FFT plans
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include "unity.h"
+#include "esp_log.h"
+
+#include "dsp_common.h"
+#include "dsp_tests.h"
+#include "fft.h"
+
+static const char *TAG = "fft_plan";
+
+#define RESP_LEN    256
+#define ECG_LEN     2048
+
+static float resp[RESP_LEN];
+static float ecg[ECG_LEN];
+static float fft_plan[ECG_LEN / 2];
+static float fft_check[ECG_LEN / 2];
+
+static void gen_signals(void)
+{
+    for (int i = 0 ; i < RESP_LEN ; i++) {
+        resp[i] = 0.2 + sinf(2 * M_PI * 0.0123 * i);
+    }
+    for (int i = 0 ; i < ECG_LEN ; i++) {
+        ecg[i] = (float)rand() / RAND_MAX - 0.5 + 2 * sinf(2 * M_PI * 0.0456 * i);
+    }
+}
+
+static void check_spectrum(int len)
+{
+    for (int i = 0 ; i < len / 2 ; i++) {
+        TEST_ASSERT_FLOAT_WITHIN(1e-4 + 1e-4 * fabsf(fft_check[i]), fft_check[i], fft_plan[i]);
+    }
+}
+
+TEST_CASE("FFT plans functionality", "[fft]")
+{
+    fft_plan_t plan_resp;
+    fft_plan_t plan_ecg;
+    TEST_ASSERT_TRUE(FFTInit());
+    TEST_ASSERT_FALSE(FFTPlanInit(&plan_resp, 100, FFT_HANN));
+    TEST_ASSERT_TRUE(FFTPlanInit(&plan_resp, RESP_LEN, FFT_HANN));
+    TEST_ASSERT_TRUE(FFTPlanInit(&plan_ecg, ECG_LEN, FFT_BLACKMAN_HARRIS));
+    gen_signals();
+    // Same result as FFTSpectrum(), with both lenghts alternated
+    for (int n = 0 ; n < 2 ; n++) {
+        FFTPlanSpectrum(&plan_resp, resp, fft_plan, FFT_MAGNITUDE);
+        FFTSpectrum(resp, fft_check, RESP_LEN, FFT_HANN, FFT_MAGNITUDE);
+        check_spectrum(RESP_LEN);
+        FFTPlanSpectrum(&plan_ecg, ecg, fft_plan, FFT_DB);
+        FFTSpectrum(ecg, fft_check, ECG_LEN, FFT_BLACKMAN_HARRIS, FFT_DB);
+        check_spectrum(ECG_LEN);
+    }
+    FFTPlanDeinit(&plan_resp);
+    FFTPlanDeinit(&plan_ecg);
+}
+
+TEST_CASE("FFT window cache", "[fft]")
+{
+    fft_plan_t plans[FFT_WINDOW_CACHE_SIZE + 1];
+    fft_window_t windows[FFT_WINDOW_CACHE_SIZE + 1] = {FFT_HANN, FFT_BLACKMAN_HARRIS, FFT_FLAT_TOP, FFT_HANN, FFT_RECTANGULAR};
+    int lenghts[FFT_WINDOW_CACHE_SIZE + 1] = {RESP_LEN, RESP_LEN, ECG_LEN, ECG_LEN, 512};
+    TEST_ASSERT_TRUE(FFTInit());
+    gen_signals();
+    for (int i = 0 ; i <= FFT_WINDOW_CACHE_SIZE ; i++) {
+        TEST_ASSERT_TRUE(FFTPlanInit(&plans[i], lenghts[i], windows[i]));
+    }
+    // One window more than the cache holds, so entries are replaced on every round
+    for (int n = 0 ; n < 3 ; n++) {
+        for (int i = 0 ; i <= FFT_WINDOW_CACHE_SIZE ; i++) {
+            FFTPlanSpectrum(&plans[i], ecg, fft_plan, FFT_MAGNITUDE);
+            FFTSpectrum(ecg, fft_check, lenghts[i], windows[i], FFT_MAGNITUDE);
+            check_spectrum(lenghts[i]);
+        }
+    }
+    FFTWindowCacheClear();
+    FFTSpectrum(ecg, fft_check, ECG_LEN, FFT_HANN, FFT_MAGNITUDE);
+    FFTPlanSpectrum(&plans[3], ecg, fft_plan, FFT_MAGNITUDE);
+    check_spectrum(ECG_LEN);
+    for (int i = 0 ; i <= FFT_WINDOW_CACHE_SIZE ; i++) {
+        FFTPlanDeinit(&plans[i]);
+    }
+}
+
+TEST_CASE("FFT plans benchmark", "[fft]")
+{
+    fft_plan_t plan_resp;
+    fft_plan_t plan_ecg;
+    TEST_ASSERT_TRUE(FFTInit());
+    TEST_ASSERT_TRUE(FFTPlanInit(&plan_resp, RESP_LEN, FFT_HANN));
+    TEST_ASSERT_TRUE(FFTPlanInit(&plan_ecg, ECG_LEN, FFT_HANN));
+    gen_signals();
+    // Alternating lenghts, the windows are generated only the first time
+    FFTWindowCacheClear();
+    unsigned int start_b = dsp_get_cpu_cycle_count();
+    FFTMagnitude(resp, fft_check, RESP_LEN);
+    FFTMagnitude(ecg, fft_check, ECG_LEN);
+    unsigned int end_b = dsp_get_cpu_cycle_count();
+    int cycles_first = end_b - start_b;
+
+    start_b = dsp_get_cpu_cycle_count();
+    FFTMagnitude(resp, fft_check, RESP_LEN);
+    FFTMagnitude(ecg, fft_check, ECG_LEN);
+    end_b = dsp_get_cpu_cycle_count();
+    int cycles_cached = end_b - start_b;
+
+    start_b = dsp_get_cpu_cycle_count();
+    FFTPlanSpectrum(&plan_resp, resp, fft_plan, FFT_MAGNITUDE);
+    FFTPlanSpectrum(&plan_ecg, ecg, fft_plan, FFT_MAGNITUDE);
+    end_b = dsp_get_cpu_cycle_count();
+    int cycles_plan = end_b - start_b;
+
+    ESP_LOGI(TAG, "%i and %i points alternated: FFTMagnitude - %i cycles (%i generating the windows), FFTPlanSpectrum - %i cycles",
+             RESP_LEN, ECG_LEN, cycles_cached, cycles_first, cycles_plan);
+    TEST_ASSERT_EXEC_IN_RANGE(1, cycles_first, cycles_cached);
+    FFTPlanDeinit(&plan_resp);
+    FFTPlanDeinit(&plan_ecg);
+}
+
+TEST_CASE("FFT radix 2 and radix 4 algorithms", "[fft]")
+{
+    TEST_ASSERT_TRUE(FFTInit());
+    gen_signals();
+    FFTSetAlgorithm(FFT_RADIX_2);
+    FFTMagnitude(ecg, fft_check, ECG_LEN);
+    unsigned int start_b = dsp_get_cpu_cycle_count();
+    FFTMagnitude(ecg, fft_check, ECG_LEN);
+    unsigned int end_b = dsp_get_cpu_cycle_count();
+    int cycles_r2 = end_b - start_b;
+    FFTSetAlgorithm(FFT_RADIX_4);
+    start_b = dsp_get_cpu_cycle_count();
+    FFTMagnitude(ecg, fft_plan, ECG_LEN);
+    end_b = dsp_get_cpu_cycle_count();
+    int cycles_r4 = end_b - start_b;
+    ESP_LOGI(TAG, "FFTMagnitude of %i points: radix 2 - %i cycles, radix 4 - %i cycles", ECG_LEN, cycles_r2, cycles_r4);
+    check_spectrum(ECG_LEN);
+}
+
+TEST_CASE("FFT inverse", "[fft]")
+{
+    fft_plan_t plan;
+    static float spectrum[ECG_LEN];
+    static float signal[ECG_LEN];
+    TEST_ASSERT_TRUE(FFTInit());
+    gen_signals();
+    for (int len = 4 ; len <= ECG_LEN ; len *= 2) {
+        // Bin 0 is the sum of the signal
+        float sum = 0;
+        for (int i = 0 ; i < len ; i++) {
+            sum += ecg[i];
+        }
+        FFTForward(ecg, spectrum, len);
+        TEST_ASSERT_FLOAT_WITHIN(1e-3, sum, spectrum[0]);
+        FFTInverse(spectrum, signal, len);
+        for (int i = 0 ; i < len ; i++) {
+            TEST_ASSERT_FLOAT_WITHIN(1e-5, ecg[i], signal[i]);
+        }
+        // In place, with a plan
+        TEST_ASSERT_TRUE(FFTPlanInit(&plan, len, FFT_RECTANGULAR));
+        memcpy(signal, ecg, len * sizeof(float));
+        FFTPlanForward(&plan, signal, signal);
+        for (int i = 0 ; i < len ; i++) {
+            TEST_ASSERT_FLOAT_WITHIN(1e-4, spectrum[i], signal[i]);
+        }
+        FFTPlanInverse(&plan, signal, signal);
+        for (int i = 0 ; i < len ; i++) {
+            TEST_ASSERT_FLOAT_WITHIN(1e-5, ecg[i], signal[i]);
+        }
+        FFTPlanDeinit(&plan);
+    }
+}
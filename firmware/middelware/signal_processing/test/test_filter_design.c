@@ -0,0 +1,247 @@
+/**
+ * @file test_filter_design.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief Unity tests of the filter design module
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include "unity.h"
+#include "esp_log.h"
+
+#include "dsp_common.h"
+#include "dsp_tests.h"
+#include "esp_dsp.h"
+#include "filter_design.h"
+#include "iir_filter.h"
+
+static const char *TAG = "filter_design";
+
+#define FS          1000.0f
+#define MAX_TAPS    1023
+
+static float sos[DESIGN_MAX_IIR_ORDER * IIR_SOS_COEFFS];
+static float fir[MAX_TAPS];
+static float check[MAX_TAPS];
+
+// Magnitude of the second order sections at frequency f
+static float sos_gain(const float *c, int n_sections, float f)
+{
+    double w = 2 * M_PI * f / FS;
+    double gain = 1;
+    for (int s = 0 ; s < n_sections ; s++, c += IIR_SOS_COEFFS) {
+        double b_re = c[0] + c[1] * cos(w) + c[2] * cos(2 * w);
+        double b_im = -c[1] * sin(w) - c[2] * sin(2 * w);
+        double a_re = 1 + c[3] * cos(w) + c[4] * cos(2 * w);
+        double a_im = -c[3] * sin(w) - c[4] * sin(2 * w);
+        gain *= sqrt((b_re * b_re + b_im * b_im) / (a_re * a_re + a_im * a_im));
+    }
+    return gain;
+}
+
+// Magnitude of a FIR filter at frequency f
+static float fir_gain(const float *h, int taps, float f)
+{
+    double w = 2 * M_PI * f / FS;
+    double re = 0;
+    double im = 0;
+    for (int i = 0 ; i < taps ; i++) {
+        re += h[i] * cos(w * i);
+        im -= h[i] * sin(w * i);
+    }
+    return sqrt(re * re + im * im);
+}
+
+TEST_CASE("Filter design IIR", "[filter]")
+{
+    DesignCacheClear();
+    for (int order = 1 ; order <= DESIGN_MAX_IIR_ORDER ; order++) {
+        int n = DesignIirSections(DESIGN_LOW_PASS, order);
+        // Butterworth and Bessel: -3 dB at the cut-off frequency
+        TEST_ASSERT_TRUE(DesignIir(sos, DESIGN_BUTTERWORTH, DESIGN_LOW_PASS, FS, 50, 0, order, 0));
+        TEST_ASSERT_FLOAT_WITHIN(1e-3, 1, sos_gain(sos, n, 0));
+        TEST_ASSERT_FLOAT_WITHIN(1e-3, M_SQRT1_2, sos_gain(sos, n, 50));
+        TEST_ASSERT_TRUE(DesignIir(sos, DESIGN_BUTTERWORTH, DESIGN_HIGH_PASS, FS, 50, 0, order, 0));
+        TEST_ASSERT_FLOAT_WITHIN(1e-3, 1, sos_gain(sos, n, FS / 2));
+        TEST_ASSERT_FLOAT_WITHIN(1e-3, M_SQRT1_2, sos_gain(sos, n, 50));
+        TEST_ASSERT_TRUE(DesignIir(sos, DESIGN_BESSEL, DESIGN_LOW_PASS, FS, 100, 0, order, 0));
+        TEST_ASSERT_FLOAT_WITHIN(1e-3, 1, sos_gain(sos, n, 0));
+        TEST_ASSERT_FLOAT_WITHIN(1e-3, M_SQRT1_2, sos_gain(sos, n, 100));
+        // Chebyshev: ripple in the pass band, -ripple at the cut-off frequency
+        TEST_ASSERT_TRUE(DesignIir(sos, DESIGN_CHEBYSHEV, DESIGN_LOW_PASS, FS, 100, 0, order, 1));
+        float min_gain = 1;
+        float max_gain = 0;
+        for (float f = 0 ; f <= 100 ; f += 0.5) {
+            float g = sos_gain(sos, n, f);
+            min_gain = fminf(min_gain, g);
+            max_gain = fmaxf(max_gain, g);
+        }
+        TEST_ASSERT_FLOAT_WITHIN(1e-3, 1, max_gain);
+        TEST_ASSERT_FLOAT_WITHIN(2e-3, powf(10, -1 / 20.0f), min_gain);
+        TEST_ASSERT_FLOAT_WITHIN(1e-3, powf(10, -1 / 20.0f), sos_gain(sos, n, 100));
+        // Steeper than Butterworth of the same order (cut-off at -1 dB instead of -3 dB)
+        if (order > 2) {
+            float g_cheby = sos_gain(sos, n, 200);
+            DesignIir(sos, DESIGN_BUTTERWORTH, DESIGN_LOW_PASS, FS, 100, 0, order, 0);
+            TEST_ASSERT_TRUE(g_cheby < sos_gain(sos, n, 200));
+        }
+    }
+    // Band pass and band stop
+    int n = DesignIirSections(DESIGN_BAND_PASS, 4);
+    TEST_ASSERT_EQUAL(4, n);
+    TEST_ASSERT_TRUE(DesignIir(sos, DESIGN_BUTTERWORTH, DESIGN_BAND_PASS, FS, 5, 40, 4, 0));
+    TEST_ASSERT_FLOAT_WITHIN(2e-2, 1, sos_gain(sos, n, sqrtf(5 * 40)));
+    TEST_ASSERT_TRUE(sos_gain(sos, n, 0.5) < 1e-2f);
+    TEST_ASSERT_TRUE(sos_gain(sos, n, 300) < 1e-2f);
+    // Order 1 is a notch
+    n = DesignIirSections(DESIGN_BAND_STOP, 1);
+    TEST_ASSERT_EQUAL(1, n);
+    TEST_ASSERT_TRUE(DesignIir(sos, DESIGN_BUTTERWORTH, DESIGN_BAND_STOP, FS, 48, 52, 1, 0));
+    TEST_ASSERT_TRUE(sos_gain(sos, n, sqrtf(48 * 52)) < 1e-3f);
+    TEST_ASSERT_FLOAT_WITHIN(2e-2, M_SQRT1_2, sos_gain(sos, n, 48));
+    TEST_ASSERT_FLOAT_WITHIN(2e-2, M_SQRT1_2, sos_gain(sos, n, 52));
+    TEST_ASSERT_FLOAT_WITHIN(1e-3, 1, sos_gain(sos, n, 0));
+    // Higher orders keep the edges at -3 dB (-ripple for Chebyshev) and are steeper
+    for (int order = 2 ; order <= 6 ; order++) {
+        n = DesignIirSections(DESIGN_BAND_STOP, order);
+        TEST_ASSERT_EQUAL(order, n);
+        TEST_ASSERT_TRUE(DesignIir(sos, DESIGN_BUTTERWORTH, DESIGN_BAND_STOP, FS, 40, 60, order, 0));
+        TEST_ASSERT_FLOAT_WITHIN(2e-3, M_SQRT1_2, sos_gain(sos, n, 40));
+        TEST_ASSERT_FLOAT_WITHIN(2e-3, M_SQRT1_2, sos_gain(sos, n, 60));
+        TEST_ASSERT_FLOAT_WITHIN(1e-3, 1, sos_gain(sos, n, 0));
+        TEST_ASSERT_FLOAT_WITHIN(1e-3, 1, sos_gain(sos, n, FS / 2));
+        TEST_ASSERT_TRUE(sos_gain(sos, n, sqrtf(40 * 60)) < 1e-3f);
+        TEST_ASSERT_TRUE(sos_gain(sos, n, 44) < powf(10, -3 * order / 20.0f));
+        TEST_ASSERT_TRUE(sos_gain(sos, n, 30) > 0.9f);
+        TEST_ASSERT_TRUE(DesignIir(sos, DESIGN_CHEBYSHEV, DESIGN_BAND_STOP, FS, 40, 60, order, 1));
+        TEST_ASSERT_FLOAT_WITHIN(2e-3, powf(10, -1 / 20.0f), sos_gain(sos, n, 40));
+        TEST_ASSERT_FLOAT_WITHIN(2e-3, powf(10, -1 / 20.0f), sos_gain(sos, n, 60));
+        TEST_ASSERT_TRUE(sos_gain(sos, n, 0) < 1 + 1e-3f);
+        TEST_ASSERT_TRUE(sos_gain(sos, n, 0) > powf(10, -1 / 20.0f) - 1e-3f);
+        TEST_ASSERT_TRUE(DesignIir(sos, DESIGN_BESSEL, DESIGN_BAND_STOP, FS, 40, 60, order, 0));
+        TEST_ASSERT_FLOAT_WITHIN(2e-3, M_SQRT1_2, sos_gain(sos, n, 40));
+        TEST_ASSERT_FLOAT_WITHIN(2e-3, M_SQRT1_2, sos_gain(sos, n, 60));
+    }
+    // Invalid parameters
+    TEST_ASSERT_FALSE(DesignIir(sos, DESIGN_BUTTERWORTH, DESIGN_LOW_PASS, FS, 600, 0, 2, 0));
+    TEST_ASSERT_FALSE(DesignIir(sos, DESIGN_BUTTERWORTH, DESIGN_BAND_PASS, FS, 40, 5, 2, 0));
+    TEST_ASSERT_FALSE(DesignIir(sos, DESIGN_CHEBYSHEV, DESIGN_LOW_PASS, FS, 40, 0, 2, 0));
+    TEST_ASSERT_FALSE(DesignIir(sos, DESIGN_BESSEL, DESIGN_LOW_PASS, FS, 40, 0, DESIGN_MAX_IIR_ORDER + 1, 0));
+    TEST_ASSERT_FALSE(DesignIir(sos, DESIGN_BUTTERWORTH, DESIGN_LOW_PASS, FS, 40, 0, 0, 0));
+    TEST_ASSERT_EQUAL(0, DesignIirSections(DESIGN_BAND_PASS, 255));
+    DesignCacheClear();
+}
+
+TEST_CASE("Filter design FIR", "[filter]")
+{
+    DesignCacheClear();
+    // Kaiser low pass, 60 dB of attenuation from 100 Hz to 120 Hz
+    uint16_t taps = DesignKaiserTaps(FS, 20, 60);
+    TEST_ASSERT_TRUE(taps & 1);
+    TEST_ASSERT_TRUE(DesignFir(fir, taps, DESIGN_KAISER, DesignKaiserBeta(60), DESIGN_LOW_PASS, FS, 110, 0));
+    TEST_ASSERT_FLOAT_WITHIN(1e-4, 1, fir_gain(fir, taps, 0));
+    for (float f = 120 ; f <= FS / 2 ; f += 1) {
+        TEST_ASSERT_TRUE(fir_gain(fir, taps, f) < powf(10, -58 / 20.0f));
+    }
+    for (float f = 0 ; f <= 100 ; f += 1) {
+        TEST_ASSERT_FLOAT_WITHIN(2e-3, 1, fir_gain(fir, taps, f));
+    }
+    // Linear phase
+    for (int i = 0 ; i < taps / 2 ; i++) {
+        TEST_ASSERT_FLOAT_WITHIN(1e-6, fir[i], fir[taps - 1 - i]);
+    }
+    // Other windows and responses
+    const design_window_t windows[] = {DESIGN_HAMMING, DESIGN_HANN, DESIGN_BLACKMAN};
+    for (int w = 0 ; w < sizeof(windows) / sizeof(windows[0]) ; w++) {
+        TEST_ASSERT_TRUE(DesignFir(fir, 101, windows[w], 0, DESIGN_HIGH_PASS, FS, 100, 0));
+        TEST_ASSERT_FLOAT_WITHIN(1e-4, 1, fir_gain(fir, 101, FS / 2));
+        TEST_ASSERT_TRUE(fir_gain(fir, 101, 20) < 1e-2f);
+        TEST_ASSERT_TRUE(DesignFir(fir, 101, windows[w], 0, DESIGN_BAND_PASS, FS, 100, 200));
+        TEST_ASSERT_FLOAT_WITHIN(1e-4, 1, fir_gain(fir, 101, 150));
+        TEST_ASSERT_TRUE(DesignFir(fir, 101, windows[w], 0, DESIGN_BAND_STOP, FS, 100, 200));
+        TEST_ASSERT_FLOAT_WITHIN(1e-4, 1, fir_gain(fir, 101, 0));
+        TEST_ASSERT_TRUE(fir_gain(fir, 101, 150) < 1e-2f);
+    }
+    // Even lenghts can not be high pass
+    TEST_ASSERT_FALSE(DesignFir(fir, 100, DESIGN_HAMMING, 0, DESIGN_HIGH_PASS, FS, 100, 0));
+    TEST_ASSERT_TRUE(DesignFir(fir, 100, DESIGN_HAMMING, 0, DESIGN_LOW_PASS, FS, 100, 0));
+    // Windows that are 0 at both ends leave nothing of a 2 taps filter to normalize
+    TEST_ASSERT_FALSE(DesignFir(fir, 2, DESIGN_HANN, 0, DESIGN_LOW_PASS, FS, 100, 0));
+    TEST_ASSERT_FALSE(DesignFir(fir, 2, DESIGN_BLACKMAN, 0, DESIGN_LOW_PASS, FS, 100, 0));
+    DesignCacheClear();
+}
+
+TEST_CASE("Filter design cache", "[filter]")
+{
+    DesignCacheClear();
+    unsigned int start_b = dsp_get_cpu_cycle_count();
+    TEST_ASSERT_TRUE(DesignFir(fir, MAX_TAPS, DESIGN_KAISER, DesignKaiserBeta(80), DESIGN_LOW_PASS, FS, 40, 0));
+    unsigned int end_b = dsp_get_cpu_cycle_count();
+    int cycles_design = end_b - start_b;
+    memcpy(check, fir, sizeof(fir));
+    // Fill the rest of the cache, the first design is the least recently used
+    for (int i = 1 ; i < DESIGN_CACHE_SIZE ; i++) {
+        TEST_ASSERT_TRUE(DesignIir(sos, DESIGN_BESSEL, DESIGN_LOW_PASS, FS, 10 * i, 0, 8, 0));
+    }
+    memset(fir, 0, sizeof(fir));
+    start_b = dsp_get_cpu_cycle_count();
+    TEST_ASSERT_TRUE(DesignFir(fir, MAX_TAPS, DESIGN_KAISER, DesignKaiserBeta(80), DESIGN_LOW_PASS, FS, 40, 0));
+    end_b = dsp_get_cpu_cycle_count();
+    int cycles_cached = end_b - start_b;
+    for (int i = 0 ; i < MAX_TAPS ; i++) {
+        TEST_ASSERT_EQUAL_FLOAT(check[i], fir[i]);
+    }
+    ESP_LOGI(TAG, "Kaiser FIR of %i taps: designed - %i cycles, cached - %i cycles", MAX_TAPS, cycles_design, cycles_cached);
+    TEST_ASSERT_EXEC_IN_RANGE(1, cycles_design / 10, cycles_cached);
+    // Replaced by a new design
+    TEST_ASSERT_TRUE(DesignIir(sos, DESIGN_BESSEL, DESIGN_LOW_PASS, FS, 100, 0, 8, 0));
+    TEST_ASSERT_TRUE(DesignFir(fir, MAX_TAPS, DESIGN_KAISER, DesignKaiserBeta(80), DESIGN_LOW_PASS, FS, 40, 0));
+    DesignCacheClear();
+}
+
+TEST_CASE("IIR filter with designed coefficients", "[filter]")
+{
+    iir_filter_t filter;
+    static float x[256];
+    static float y[256];
+    // Same Butterworth coefficients as before the design engine
+    TEST_ASSERT_TRUE(IirFilterInit(&filter, IIR_LOW_PASS, FS, 40, 4, 1));
+    for (int k = 0 ; k < 2 ; k++) {
+        dsps_biquad_gen_lpf_f32(&sos[k * IIR_SOS_COEFFS], 40 / FS, 1.0f / (2.0f * sinf((2 * k + 1) * M_PI / 8.0f)));
+    }
+    for (int i = 0 ; i < 2 * IIR_SOS_COEFFS ; i++) {
+        TEST_ASSERT_FLOAT_WITHIN(1e-5, sos[i], filter.coeffs[i]);
+    }
+    IirFilterDeinit(&filter);
+    // Odd order and coefficients changed while filtering
+    TEST_ASSERT_TRUE(IirFilterInit(&filter, IIR_HI_PASS, FS, 0.5, 3, 1));
+    TEST_ASSERT_EQUAL(2, filter.n_sections);
+    for (int i = 0 ; i < 256 ; i++) {
+        x[i] = 1;
+    }
+    IirFilterApply(&filter, 0, x, y, 256);
+    TEST_ASSERT_TRUE(DesignIir(sos, DESIGN_BESSEL, DESIGN_HIGH_PASS, FS, 5, 0, 3, 0));
+    TEST_ASSERT_FALSE(IirFilterSetCoeffs(&filter, sos, 1));
+    TEST_ASSERT_TRUE(IirFilterSetCoeffs(&filter, sos, 2));
+    for (int n = 0 ; n < 8 ; n++) {
+        IirFilterApply(&filter, 0, x, y, 256);
+    }
+    // DC removed with the new cut-off frequency, once the transient of the change ends
+    TEST_ASSERT_FLOAT_WITHIN(1e-3, 0, y[255]);
+    IirFilterDeinit(&filter);
+    TEST_ASSERT_TRUE(IirFilterInitCoeffs(&filter, sos, 2, 3));
+    TEST_ASSERT_EQUAL(3, filter.n_channels);
+    IirFilterDeinit(&filter);
+    // Butterworth orders beyond the Bessel limit
+    TEST_ASSERT_TRUE(IirFilterInit(&filter, IIR_LOW_PASS, FS, 40, 2 * DESIGN_MAX_IIR_ORDER, 1));
+    TEST_ASSERT_EQUAL(DESIGN_MAX_IIR_ORDER, filter.n_sections);
+    TEST_ASSERT_FLOAT_WITHIN(1e-3, 1, sos_gain(filter.coeffs, filter.n_sections, 0));
+    TEST_ASSERT_FLOAT_WITHIN(1e-3, M_SQRT1_2, sos_gain(filter.coeffs, filter.n_sections, 40));
+    IirFilterDeinit(&filter);
+}
@@ -0,0 +1,110 @@
+/**
+ * @file test_fir_filter.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief Unity tests of the FIR filter module
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include "unity.h"
+#include "esp_log.h"
+
+#include "dsp_common.h"
+#include "dsp_tests.h"
+#include "esp_dsp.h"
+#include "fir_filter.h"
+
+static const char *TAG = "fir_filter";
+
+#define SIG_LEN     4096
+#define MAX_TAPS    1024
+
+static float signal[SIG_LEN];
+static float coeffs[MAX_TAPS];
+static float output[SIG_LEN];
+static float check[SIG_LEN];
+
+static void gen_signals(void)
+{
+    for (int i = 0 ; i < SIG_LEN ; i++) {
+        signal[i] = (float)rand() / RAND_MAX - 0.5;
+    }
+    for (int i = 0 ; i < MAX_TAPS ; i++) {
+        coeffs[i] = (float)rand() / RAND_MAX - 0.5;
+    }
+}
+
+static void check_taps(int taps)
+{
+    fir_filter_t filter;
+    fir_f32_t fir;
+    TEST_ASSERT_TRUE(FirFilterInit(&filter, coeffs, taps));
+    TEST_ESP_OK(dsps_fir_init_f32(&fir, coeffs, NULL, taps));
+    dsps_fir_f32_ansi(&fir, signal, check, SIG_LEN);
+    // Chunks of several lenghts, not aligned with the partitions
+    int chunk = 1;
+    for (int i = 0 ; i < SIG_LEN ; i += chunk) {
+        chunk = 1 + (i * 7) % 151;
+        if (i + chunk > SIG_LEN) {
+            chunk = SIG_LEN - i;
+        }
+        FirFilterProcess(&filter, &signal[i], &output[i], chunk);
+    }
+    for (int i = 0 ; i < SIG_LEN ; i++) {
+        TEST_ASSERT_FLOAT_WITHIN(1e-4 * sqrtf(taps), check[i], output[i]);
+    }
+    // In place, after a reset
+    FirFilterReset(&filter);
+    memcpy(output, signal, sizeof(signal));
+    FirFilterProcess(&filter, output, output, SIG_LEN);
+    for (int i = 0 ; i < SIG_LEN ; i++) {
+        TEST_ASSERT_FLOAT_WITHIN(1e-4 * sqrtf(taps), check[i], output[i]);
+    }
+    FirFilterDeinit(&filter);
+    dsps_fir_f32_free(&fir);
+}
+
+TEST_CASE("FIR filter functionality", "[fir]")
+{
+    TEST_ASSERT_TRUE(FFTInit());
+    TEST_ASSERT_FALSE(FirFilterInit(NULL, coeffs, 0));
+    gen_signals();
+    // Direct form, and FFT form with complete and incomplete last partition
+    const int taps[] = {1, 15, FIR_FFT_THRESHOLD - 1, FIR_FFT_THRESHOLD, 200, 512, 777, 1024};
+    for (int i = 0 ; i < sizeof(taps) / sizeof(taps[0]) ; i++) {
+        check_taps(taps[i]);
+    }
+}
+
+TEST_CASE("FIR filter benchmark", "[fir]")
+{
+    fir_filter_t filter;
+    fir_f32_t fir;
+    TEST_ASSERT_TRUE(FFTInit());
+    gen_signals();
+    for (int taps = 512 ; taps <= MAX_TAPS ; taps += 256) {
+        TEST_ASSERT_TRUE(FirFilterInit(&filter, coeffs, taps));
+        TEST_ESP_OK(dsps_fir_init_f32(&fir, coeffs, NULL, taps));
+        unsigned int start_b = dsp_get_cpu_cycle_count();
+        dsps_fir_f32_ansi(&fir, signal, check, SIG_LEN);
+        unsigned int end_b = dsp_get_cpu_cycle_count();
+        int cycles_direct = end_b - start_b;
+
+        start_b = dsp_get_cpu_cycle_count();
+        FirFilterProcess(&filter, signal, output, SIG_LEN);
+        end_b = dsp_get_cpu_cycle_count();
+        int cycles_fft = end_b - start_b;
+
+        ESP_LOGI(TAG, "%i taps, %i samples: dsps_fir_f32_ansi - %i cycles/sample, FirFilterProcess - %i cycles/sample",
+                 taps, SIG_LEN, cycles_direct / SIG_LEN, cycles_fft / SIG_LEN);
+        TEST_ASSERT_EXEC_IN_RANGE(1, cycles_direct, cycles_fft);
+        FirFilterDeinit(&filter);
+        dsps_fir_f32_free(&fir);
+    }
+}
@@ -0,0 +1,96 @@
+/**
+ * @file test_goertzel.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief Unity tests of the Goertzel module
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include "unity.h"
+#include "esp_log.h"
+
+#include "dsp_common.h"
+#include "dsp_tests.h"
+#include "fft.h"
+#include "goertzel.h"
+
+static const char *TAG = "goertzel";
+
+#define FS      1000.0
+#define LEN     1024
+#define MAX_FREQS 16
+
+static float signal[LEN];
+static float fft[LEN / 2];
+static int callbacks;
+
+static void count_blocks(float *magnitude, void *param_p)
+{
+    callbacks += *(int *)param_p;
+}
+
+TEST_CASE("Goertzel functionality", "[goertzel]")
+{
+    goertzel_t goertzel;
+    int one = 1;
+    // 50 Hz (1.5 of amplitude) and 60 Hz (not present) on a bin, 12.3 Hz (0.5 of amplitude) between bins
+    float freqs[3] = {50 * FS / LEN, 60 * FS / LEN, 12.3};
+    for (int i = 0 ; i < LEN ; i++) {
+        signal[i] = 1 + 1.5 * sinf(2 * M_PI * freqs[0] / FS * i) + 0.5 * cosf(2 * M_PI * freqs[2] / FS * i);
+    }
+    TEST_ASSERT_FALSE(GoertzelInit(&goertzel, FS, freqs, 0, LEN, NULL, NULL));
+    TEST_ASSERT_TRUE(GoertzelInit(&goertzel, FS, freqs, 3, LEN, count_blocks, &one));
+    // Chunks of different sizes, the block finishes in the middle of the last one
+    callbacks = 0;
+    TEST_ASSERT_EQUAL(0, GoertzelProcess(&goertzel, signal, 1));
+    TEST_ASSERT_EQUAL(0, GoertzelProcess(&goertzel, &signal[1], 500));
+    TEST_ASSERT_EQUAL(1, GoertzelProcess(&goertzel, &signal[501], LEN - 501));
+    TEST_ASSERT_EQUAL(1, callbacks);
+    float *magnitude = GoertzelMagnitude(&goertzel);
+    ESP_LOGI(TAG, "Magnitudes: %f, %f, %f", magnitude[0], magnitude[1], magnitude[2]);
+    // No window: leakage of the other tones and DC is below 1 %
+    TEST_ASSERT_FLOAT_WITHIN(1.5e-2, 1.5, magnitude[0]);
+    TEST_ASSERT_FLOAT_WITHIN(1e-2, 0, magnitude[1]);
+    TEST_ASSERT_FLOAT_WITHIN(0.05, 0.5, magnitude[2]);
+    // Next block starts from zero
+    float first = magnitude[0];
+    TEST_ASSERT_EQUAL(1, GoertzelProcess(&goertzel, signal, LEN));
+    TEST_ASSERT_FLOAT_WITHIN(1e-6, first, magnitude[0]);
+    TEST_ASSERT_EQUAL(2, goertzel.blocks);
+    GoertzelDeinit(&goertzel);
+}
+
+TEST_CASE("Goertzel benchmark against FFTMagnitude", "[goertzel]")
+{
+    float freqs[MAX_FREQS];
+    goertzel_t goertzel;
+    TEST_ASSERT_TRUE(FFTInit());
+    for (int i = 0 ; i < LEN ; i++) {
+        signal[i] = sinf(2 * M_PI * 50 / FS * i);
+    }
+    FFTMagnitude(signal, fft, LEN);
+    unsigned int start_b = dsp_get_cpu_cycle_count();
+    FFTMagnitude(signal, fft, LEN);
+    unsigned int end_b = dsp_get_cpu_cycle_count();
+    int cycles_fft = end_b - start_b;
+
+    for (int n = 1 ; n <= MAX_FREQS ; n *= 2) {
+        for (int i = 0 ; i < n ; i++) {
+            freqs[i] = 10 + 5 * i;
+        }
+        TEST_ASSERT_TRUE(GoertzelInit(&goertzel, FS, freqs, n, LEN, NULL, NULL));
+        start_b = dsp_get_cpu_cycle_count();
+        GoertzelProcess(&goertzel, signal, LEN);
+        end_b = dsp_get_cpu_cycle_count();
+        int cycles_goertzel = end_b - start_b;
+        ESP_LOGI(TAG, "%2i frequencies, %i samples: Goertzel - %i cycles, FFTMagnitude - %i cycles", n, LEN, cycles_goertzel, cycles_fft);
+        TEST_ASSERT_EXEC_IN_RANGE(1, 100 * LEN * n, cycles_goertzel);
+        GoertzelDeinit(&goertzel);
+    }
+}
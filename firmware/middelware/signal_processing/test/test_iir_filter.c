@@ -0,0 +1,125 @@
+/**
+ * @file test_iir_filter.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief Unity tests of the IIR filter module
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include "unity.h"
+#include "esp_log.h"
+
+#include "dsp_common.h"
+#include "dsp_tests.h"
+#include "esp_dsp.h"
+#include "iir_filter.h"
+
+#define FS          1000
+#define SIG_LEN     1000
+
+static float signal[SIG_LEN];
+static float output[SIG_LEN];
+static float ext[SIG_LEN + 2 * IIR_ZERO_PHASE_MAX_PAD];
+
+// Reference: explicit odd extension, forward filter, reversed copy, backward filter
+static void filtfilt_reference(iir_filter_t *filter, const float *x, float *y, int len)
+{
+    int pad = 3 * (2 * filter->n_sections + 1);
+    int n = len + 2 * pad;
+    float zi[2 * 32];
+    for (int k = 0 ; k < pad ; k++) {
+        ext[k] = 2 * x[0] - x[pad - k];
+        ext[pad + len + k] = 2 * x[len - 1] - x[len - 2 - k];
+    }
+    memcpy(&ext[pad], x, len * sizeof(float));
+    for (int pass = 0 ; pass < 2 ; pass++) {
+        float in = ext[0];
+        for (int s = 0 ; s < filter->n_sections ; s++) {
+            const float *c = &filter->coeffs[s * IIR_SOS_COEFFS];
+            zi[2 * s] = zi[2 * s + 1] = in / (1 + c[3] + c[4]);
+            in = (c[0] + c[1] + c[2]) * zi[2 * s];
+        }
+        dsps_biquad_sos_f32(ext, ext, n, filter->coeffs, zi, filter->n_sections);
+        for (int k = 0 ; k < n / 2 ; k++) {
+            float t = ext[k];
+            ext[k] = ext[n - 1 - k];
+            ext[n - 1 - k] = t;
+        }
+    }
+    memcpy(y, &ext[pad], len * sizeof(float));
+}
+
+TEST_CASE("IIR zero phase filtering", "[iir]")
+{
+    iir_filter_t filter;
+    TEST_ASSERT_TRUE(IirFilterInit(&filter, IIR_LOW_PASS, FS, 20, 4, 2));
+    // Gaussian pulse centered at 400 plus offset and noise
+    for (int i = 0 ; i < SIG_LEN ; i++) {
+        signal[i] = 1.5 + expf(-powf((i - 400) / 20.0, 2)) + 0.2 * ((float)rand() / RAND_MAX - 0.5);
+    }
+    filtfilt_reference(&filter, signal, output, SIG_LEN);
+    IirFilterZeroPhase(&filter, 1, signal, SIG_LEN);
+    int peak = 0;
+    for (int i = 0 ; i < SIG_LEN ; i++) {
+        TEST_ASSERT_FLOAT_WITHIN(1e-4, output[i], signal[i]);
+        if (signal[i] > signal[peak]) {
+            peak = i;
+        }
+    }
+    // No delay, and no transient at the edges from the offset (only the noise of the edge samples)
+    TEST_ASSERT_INT_WITHIN(2, 400, peak);
+    TEST_ASSERT_FLOAT_WITHIN(0.15, 1.5, signal[0]);
+    TEST_ASSERT_FLOAT_WITHIN(0.15, 1.5, signal[SIG_LEN - 1]);
+    for (int i = 0 ; i < filter.n_sections * IIR_SOS_DELAY * 2 ; i++) {
+        TEST_ASSERT_EQUAL_FLOAT(0, filter.delay[i]);
+    }
+    // Magnitude response squared: -6 dB at the cut-off frequency
+    for (int i = 0 ; i < SIG_LEN ; i++) {
+        signal[i] = sinf(2 * M_PI * 20 * i / FS);
+    }
+    IirFilterZeroPhase(&filter, 0, signal, SIG_LEN);
+    TEST_ASSERT_FLOAT_WITHIN(0.02, 0.5, signal[SIG_LEN / 2 + FS / 80]);
+    // Short blocks
+    signal[0] = 3;
+    IirFilterZeroPhase(&filter, 0, signal, 1);
+    TEST_ASSERT_FLOAT_WITHIN(1e-4, 3, signal[0]);
+    IirFilterDeinit(&filter);
+}
+
+TEST_CASE("IIR interleaved channels", "[iir]")
+{
+    const int channels = 3;
+    const int len = SIG_LEN / channels;
+    const int split = 100;
+    iir_filter_t inter, single;
+    float chan[SIG_LEN / 3];
+    TEST_ASSERT_TRUE(IirFilterInit(&inter, IIR_HI_PASS, FS, 5, 3, channels));
+    TEST_ASSERT_TRUE(IirFilterInit(&single, IIR_HI_PASS, FS, 5, 3, channels));
+    // A different offset and tone on each channel
+    for (int i = 0 ; i < len ; i++) {
+        for (int ch = 0 ; ch < channels ; ch++) {
+            signal[i * channels + ch] = ch - 1 + sinf(2 * M_PI * (ch + 1) * 7 * i / FS);
+        }
+    }
+    // In place and split in two blocks: the state of each channel must carry over
+    memcpy(output, signal, len * channels * sizeof(float));
+    IirFilterApplyInterleaved(&inter, output, output, split);
+    IirFilterApplyInterleaved(&inter, &output[split * channels], &output[split * channels], len - split);
+    for (int ch = 0 ; ch < channels ; ch++) {
+        for (int i = 0 ; i < len ; i++) {
+            chan[i] = signal[i * channels + ch];
+        }
+        IirFilterApply(&single, ch, chan, chan, len);
+        for (int i = 0 ; i < len ; i++) {
+            TEST_ASSERT_FLOAT_WITHIN(1e-5, chan[i], output[i * channels + ch]);
+        }
+    }
+    IirFilterDeinit(&inter);
+    IirFilterDeinit(&single);
+}
@@ -0,0 +1,109 @@
+/**
+ * @file test_mains_canceller.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief Unity tests of the mains canceller module
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include "unity.h"
+#include "esp_log.h"
+
+#include "dsp_common.h"
+#include "dsp_tests.h"
+#include "esp_dsp.h"
+#include "mains_canceller.h"
+
+static const char *TAG = "mains_canceller";
+
+#define FS          500
+#define SIG_LEN     (30 * FS)
+#define SETTLE      (3 * FS)
+#define CHUNK       100
+
+static float ecg[SIG_LEN];
+static float signal[SIG_LEN];
+static float mains[SIG_LEN];
+
+// Synthetic ECG at 72 bpm: P, QRS and T waves as gaussians (mV)
+static float ecg_sample(float t)
+{
+    const float amp[] = {0.15, -0.1, 1.2, -0.25, 0.3};
+    const float pos[] = {-0.2, -0.03, 0, 0.03, 0.25};
+    const float width[] = {0.025, 0.01, 0.012, 0.01, 0.04};
+    float beat = 60.0 / 72;
+    float x = fmodf(t, beat) - beat / 2;
+    float y = 0;
+    for (int i = 0 ; i < 5 ; i++) {
+        y += amp[i] * expf(-powf((x - pos[i]) / width[i], 2) / 2);
+    }
+    return y;
+}
+
+static float rms_error(const float *x, int start, int end)
+{
+    float acc = 0;
+    for (int i = start ; i < end ; i++) {
+        acc += (x[i] - ecg[i]) * (x[i] - ecg[i]);
+    }
+    return sqrtf(acc / (end - start));
+}
+
+TEST_CASE("Mains canceller functionality", "[mains]")
+{
+    mains_canceller_t canceller;
+    TEST_ASSERT_FALSE(MainsCancellerInit(&canceller, FS, 0, 1));
+    TEST_ASSERT_FALSE(MainsCancellerInit(&canceller, 100, 50, 1));
+    TEST_ASSERT_TRUE(MainsCancellerInit(&canceller, FS, 50, 1));
+
+    // 0.5 mV interference drifting between 49 and 51 Hz with a period of 20 s, plus noise
+    float phase = 0;
+    float frec;
+    for (int i = 0 ; i < SIG_LEN ; i++) {
+        frec = 50 + sinf(2 * M_PI * i / (20 * FS));
+        phase += 2 * M_PI * frec / FS;
+        ecg[i] = ecg_sample((float)i / FS) + 0.01 * ((float)rand() / RAND_MAX - 0.5);
+        mains[i] = 0.5 * cosf(phase + 1);
+        signal[i] = ecg[i] + mains[i];
+    }
+    float before = rms_error(signal, SETTLE, SIG_LEN);
+    for (int i = 0 ; i < SIG_LEN ; i += CHUNK) {
+        MainsCancellerProcess(&canceller, &signal[i], &signal[i], CHUNK);
+        if (i >= SETTLE) {
+            frec = 50 + sinf(2 * M_PI * i / (20 * FS));
+            TEST_ASSERT_FLOAT_WITHIN(0.1, frec, MainsCancellerFrequency(&canceller));
+        }
+    }
+    float after = rms_error(signal, SETTLE, SIG_LEN);
+    ESP_LOGI(TAG, "Interference %f mV rms, residual %f mV rms (%.1f dB)", before, after, 20 * log10f(after / before));
+    TEST_ASSERT_TRUE(after < before * 0.05f);
+    TEST_ASSERT_FLOAT_WITHIN(0.05, 0.5, MainsCancellerAmplitude(&canceller));
+
+    // ECG without interference goes through
+    MainsCancellerReset(&canceller);
+    memcpy(signal, ecg, sizeof(signal));
+    MainsCancellerProcess(&canceller, signal, signal, SIG_LEN / 2);
+    after = rms_error(signal, SETTLE, SIG_LEN / 2);
+    ESP_LOGI(TAG, "Distortion without interference %f mV rms", after);
+    TEST_ASSERT_TRUE(after < 0.02f);
+    MainsCancellerDeinit(&canceller);
+}
+
+TEST_CASE("Mains canceller benchmark", "[mains]")
+{
+    mains_canceller_t canceller;
+    TEST_ASSERT_TRUE(MainsCancellerInit(&canceller, FS, 50, 1));
+    unsigned int start_b = dsp_get_cpu_cycle_count();
+    MainsCancellerProcess(&canceller, signal, signal, SIG_LEN);
+    unsigned int end_b = dsp_get_cpu_cycle_count();
+    int cycles = end_b - start_b;
+    ESP_LOGI(TAG, "MainsCancellerProcess - %i cycles/sample", cycles / SIG_LEN);
+    TEST_ASSERT_EXEC_IN_RANGE(1, 100 * SIG_LEN, cycles);
+    MainsCancellerDeinit(&canceller);
+}
@@ -0,0 +1,150 @@
+/**
+ * @file test_median_filter.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief Unity tests of the median and Hampel filter module
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include "unity.h"
+#include "esp_log.h"
+
+#include "dsp_common.h"
+#include "dsp_tests.h"
+#include "median_filter.h"
+
+static const char *TAG = "median_filter";
+
+#define SIG_LEN     2000
+#define MAX_WINDOW  31
+
+static float signal[SIG_LEN];
+static float output[SIG_LEN];
+static float check[SIG_LEN];
+
+static int compare(const void *a, const void *b)
+{
+    float fa = *(const float *)a;
+    float fb = *(const float *)b;
+    return (fa > fb) - (fa < fb);
+}
+
+// Median of the last lenght samples, sorting a copy of the window
+static void median_reference(const float *x, float *y, int len, int lenght)
+{
+    float window[MAX_WINDOW];
+    for (int i = 0 ; i < len ; i++) {
+        int first = (i + 1 < lenght) ? 0 : i + 1 - lenght;
+        int n = i + 1 - first;
+        memcpy(window, &x[first], n * sizeof(float));
+        qsort(window, n, sizeof(float), compare);
+        y[i] = (n % 2) ? window[n / 2] : (window[n / 2 - 1] + window[n / 2]) / 2;
+    }
+}
+
+TEST_CASE("Median filter functionality", "[median]")
+{
+    median_filter_t filter;
+    TEST_ASSERT_FALSE(MedianFilterInit(&filter, 0));
+    // Quantized values, so there are repeated samples in the window
+    for (int i = 0 ; i < SIG_LEN ; i++) {
+        signal[i] = roundf(20 * sinf(2 * M_PI * i / 500) + 10 * ((float)rand() / RAND_MAX - 0.5));
+    }
+    for (int lenght = 1 ; lenght <= MAX_WINDOW ; lenght++) {
+        TEST_ASSERT_TRUE(MedianFilterInit(&filter, lenght));
+        median_reference(signal, check, SIG_LEN, lenght);
+        // Chunks of several lenghts, the second half in place
+        int chunk = 1;
+        for (int i = 0 ; i < SIG_LEN ; i += chunk) {
+            chunk = 1 + (i * 7) % 61;
+            if (i + chunk > SIG_LEN) {
+                chunk = SIG_LEN - i;
+            }
+            if (i < SIG_LEN / 2) {
+                MedianFilterProcess(&filter, &signal[i], &output[i], chunk);
+            } else {
+                memcpy(&output[i], &signal[i], chunk * sizeof(float));
+                MedianFilterProcess(&filter, &output[i], &output[i], chunk);
+            }
+        }
+        for (int i = 0 ; i < SIG_LEN ; i++) {
+            TEST_ASSERT_EQUAL_FLOAT(check[i], output[i]);
+        }
+        MedianFilterReset(&filter);
+        MedianFilterProcess(&filter, signal, output, 1);
+        TEST_ASSERT_EQUAL_FLOAT(signal[0], output[0]);
+        MedianFilterDeinit(&filter);
+    }
+}
+
+TEST_CASE("Hampel filter functionality", "[median]")
+{
+    hampel_filter_t filter;
+    TEST_ASSERT_FALSE(HampelFilterInit(&filter, 7, -1));
+    TEST_ASSERT_TRUE(HampelFilterInit(&filter, 7, 3));
+    // Distance readings: slow changes, a step, noise and false echoes every 37 samples
+    for (int i = 0 ; i < SIG_LEN ; i++) {
+        check[i] = 100 + 30 * sinf(2 * M_PI * i / 1000) + ((i >= SIG_LEN / 2) ? 50 : 0) + ((float)rand() / RAND_MAX - 0.5);
+        signal[i] = (i % 37 == 20) ? 400 : check[i];
+    }
+    uint16_t outliers = HampelFilterProcess(&filter, signal, output, SIG_LEN);
+    TEST_ASSERT_EQUAL(outliers, filter.outliers);
+    ESP_LOGI(TAG, "%i spikes, %i samples replaced", SIG_LEN / 37, outliers);
+    int changed = 0;
+    for (int i = 0 ; i < SIG_LEN ; i++) {
+        if (i % 37 == 20) {
+            // All spikes removed
+            TEST_ASSERT_FLOAT_WITHIN(2, check[i], output[i]);
+        } else if (output[i] != signal[i]) {
+            // Other samples only replaced by a close value (noise in the tails, start of the step)
+            TEST_ASSERT_TRUE((fabsf(output[i] - check[i]) < 2) || (i >= SIG_LEN / 2 && i < SIG_LEN / 2 + 4));
+            changed++;
+        }
+    }
+    // With 7 samples the deviation estimate is noisy, so some samples in the tails of the noise are replaced
+    TEST_ASSERT_LESS_THAN(SIG_LEN / 10, changed);
+    // The step goes through after half the window
+    TEST_ASSERT_FLOAT_WITHIN(2, check[SIG_LEN / 2 + 4], output[SIG_LEN / 2 + 4]);
+    HampelFilterReset(&filter);
+    TEST_ASSERT_EQUAL(0, filter.outliers);
+    HampelFilterDeinit(&filter);
+}
+
+TEST_CASE("Median filter benchmark", "[median]")
+{
+    median_filter_t filter;
+    hampel_filter_t hampel;
+    for (int i = 0 ; i < SIG_LEN ; i++) {
+        signal[i] = (float)rand() / RAND_MAX;
+    }
+    for (int lenght = 3 ; lenght <= MAX_WINDOW ; lenght += 4) {
+        TEST_ASSERT_TRUE(MedianFilterInit(&filter, lenght));
+        TEST_ASSERT_TRUE(HampelFilterInit(&hampel, lenght, 3));
+        unsigned int start_b = dsp_get_cpu_cycle_count();
+        median_reference(signal, check, SIG_LEN, lenght);
+        unsigned int end_b = dsp_get_cpu_cycle_count();
+        int cycles_sort = end_b - start_b;
+
+        start_b = dsp_get_cpu_cycle_count();
+        MedianFilterProcess(&filter, signal, output, SIG_LEN);
+        end_b = dsp_get_cpu_cycle_count();
+        int cycles_median = end_b - start_b;
+
+        start_b = dsp_get_cpu_cycle_count();
+        HampelFilterProcess(&hampel, signal, output, SIG_LEN);
+        end_b = dsp_get_cpu_cycle_count();
+        int cycles_hampel = end_b - start_b;
+
+        ESP_LOGI(TAG, "window %i: sorting each window - %i cycles/sample, MedianFilterProcess - %i cycles/sample, HampelFilterProcess - %i cycles/sample",
+                 lenght, cycles_sort / SIG_LEN, cycles_median / SIG_LEN, cycles_hampel / SIG_LEN);
+        TEST_ASSERT_EXEC_IN_RANGE(1, cycles_sort, cycles_median);
+        MedianFilterDeinit(&filter);
+        HampelFilterDeinit(&hampel);
+    }
+}
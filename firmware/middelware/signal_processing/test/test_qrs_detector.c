@@ -0,0 +1,143 @@
+/**
+ * @file test_qrs_detector.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief Unity tests of the QRS detector module
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include "unity.h"
+#include "esp_log.h"
+
+#include "dsp_common.h"
+#include "dsp_tests.h"
+#include "esp_dsp.h"
+#include "qrs_detector.h"
+
+static const char *TAG = "qrs_detector";
+
+#define FS          500
+#define SIG_LEN     (60 * FS)
+#define MAX_BEATS   256
+#define TOLERANCE   (FS / 100)
+
+static float signal[SIG_LEN];
+static uint32_t r_peaks[MAX_BEATS];
+static int n_r_peaks;
+static qrs_beat_t found[MAX_BEATS];
+static int n_found;
+
+// Synthetic ECG (mV): P, QRS and T waves as gaussians around each R peak, with a heart rate going
+// from 60 to 150 bpm and back, baseline wander and noise. One beat is small, to be found by search back
+static void gen_ecg(void)
+{
+    const float amp[] = {0.15, -0.1, 1.2, -0.25, 0.35};
+    const float pos[] = {-0.16, -0.03, 0, 0.03, 0.25};
+    const float width[] = {0.025, 0.01, 0.012, 0.01, 0.04};
+    float t = 0.5;
+    n_r_peaks = 0;
+    while (t < (float)SIG_LEN / FS - 0.5) {
+        r_peaks[n_r_peaks++] = roundf(t * FS);
+        t += 60.0 / (105 - 45 * cosf(2 * M_PI * t / 60));
+    }
+    for (int i = 0 ; i < SIG_LEN ; i++) {
+        signal[i] = 0.3 * sinf(2 * M_PI * 0.3 * i / FS) + 0.02 * ((float)rand() / RAND_MAX - 0.5);
+    }
+    for (int b = 0 ; b < n_r_peaks ; b++) {
+        float scale = (b == n_r_peaks / 2) ? 0.45 : 1;
+        for (int k = 0 ; k < 5 ; k++) {
+            for (int i = -FS / 5 ; i <= FS / 5 ; i++) {
+                int n = r_peaks[b] + pos[k] * FS + i;
+                if (n >= 0 && n < SIG_LEN) {
+                    signal[n] += scale * amp[k] * expf(-powf((float)i / FS / width[k], 2) / 2);
+                }
+            }
+        }
+    }
+}
+
+static void on_beat(qrs_beat_t *beat, void *param_p)
+{
+    if (n_found < MAX_BEATS) {
+        found[n_found++] = *beat;
+    }
+}
+
+TEST_CASE("QRS detector functionality", "[qrs]")
+{
+    qrs_detector_t detector;
+    TEST_ASSERT_FALSE(QrsDetectorInit(&detector, 20, NULL, NULL));
+    TEST_ASSERT_TRUE(QrsDetectorInit(&detector, FS, on_beat, NULL));
+    gen_ecg();
+    // ADC-like scale and offset, thresholds are relative
+    for (int i = 0 ; i < SIG_LEN ; i++) {
+        signal[i] = 1000 + 800 * signal[i];
+    }
+    n_found = 0;
+    int beats = 0;
+    for (int i = 0 ; i < SIG_LEN ; i += 50) {
+        beats += QrsDetectorProcess(&detector, &signal[i], 50);
+    }
+    TEST_ASSERT_EQUAL(n_found, beats);
+    // All the beats after the learning time, at the right place
+    int expected = 0;
+    for (int b = 0 ; b < n_r_peaks ; b++) {
+        expected += (r_peaks[b] >= QRS_LEARN * FS);
+    }
+    ESP_LOGI(TAG, "%i beats, %i detected", expected, n_found);
+    TEST_ASSERT_INT_WITHIN(1, expected, n_found);
+    int b = 0;
+    for (int i = 0 ; i < n_found ; i++) {
+        while (b < n_r_peaks - 1 && r_peaks[b] + TOLERANCE < found[i].sample) {
+            b++;
+        }
+        TEST_ASSERT_INT_WITHIN(TOLERANCE, r_peaks[b], found[i].sample);
+        if (i > 0 && b > 0) {
+            float hr = 60.0 * FS / (r_peaks[b] - r_peaks[b - 1]);
+            TEST_ASSERT_FLOAT_WITHIN(hr * 0.05, hr, found[i].heart_rate);
+        }
+    }
+    TEST_ASSERT_EQUAL_FLOAT(found[n_found - 1].heart_rate, QrsDetectorHeartRate(&detector));
+
+    // Same result after a reset, in a single block
+    int first = n_found;
+    QrsDetectorReset(&detector);
+    QrsDetectorProcess(&detector, signal, SIG_LEN);
+    TEST_ASSERT_EQUAL(2 * first, n_found);
+    for (int i = 0 ; i < first ; i++) {
+        TEST_ASSERT_EQUAL(found[i].sample, found[first + i].sample);
+    }
+
+    // Inverted lead
+    for (int i = 0 ; i < SIG_LEN ; i++) {
+        signal[i] = -signal[i];
+    }
+    n_found = first;
+    QrsDetectorReset(&detector);
+    QrsDetectorProcess(&detector, signal, SIG_LEN);
+    TEST_ASSERT_EQUAL(2 * first, n_found);
+    for (int i = 0 ; i < first ; i++) {
+        TEST_ASSERT_INT_WITHIN(TOLERANCE, found[i].sample, found[first + i].sample);
+    }
+    QrsDetectorDeinit(&detector);
+}
+
+TEST_CASE("QRS detector benchmark", "[qrs]")
+{
+    qrs_detector_t detector;
+    TEST_ASSERT_TRUE(QrsDetectorInit(&detector, FS, NULL, NULL));
+    gen_ecg();
+    unsigned int start_b = dsp_get_cpu_cycle_count();
+    QrsDetectorProcess(&detector, signal, SIG_LEN);
+    unsigned int end_b = dsp_get_cpu_cycle_count();
+    int cycles = end_b - start_b;
+    ESP_LOGI(TAG, "QrsDetectorProcess - %i cycles/sample", cycles / SIG_LEN);
+    TEST_ASSERT_EXEC_IN_RANGE(1, 200 * SIG_LEN, cycles);
+    QrsDetectorDeinit(&detector);
+}
@@ -0,0 +1,88 @@
+/**
+ * @file test_stft.c
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief Unity tests of the STFT module
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include "unity.h"
+#include "esp_log.h"
+
+#include "dsp_common.h"
+#include "dsp_tests.h"
+#include "stft.h"
+
+#define SIG_LEN     5000
+#define MAX_FRAMES  80
+
+typedef struct {
+    uint16_t lenght;
+    uint16_t hop;
+    fft_window_t window;
+    int n_frames;
+    float frames[MAX_FRAMES][512 / 2];
+} frames_t;
+
+static float signal[SIG_LEN];
+static float check[512 / 2];
+static float other[1024 / 2];
+static frames_t frames_a = {512, 128, FFT_BLACKMAN};
+static frames_t frames_b = {256, 64, FFT_HANN};
+
+static void store_frame(float *frame, void *param_p)
+{
+    frames_t *frames = (frames_t *)param_p;
+    TEST_ASSERT_LESS_THAN(MAX_FRAMES, frames->n_frames);
+    memcpy(frames->frames[frames->n_frames++], frame, frames->lenght / 2 * sizeof(float));
+    // Spectrum of another lenght and window between frames
+    FFTMagnitudeWindow(signal, other, 1024, FFT_FLAT_TOP);
+}
+
+static void check_frames(frames_t *frames)
+{
+    TEST_ASSERT_EQUAL((SIG_LEN - frames->lenght) / frames->hop + 1, frames->n_frames);
+    for (int f = 0 ; f < frames->n_frames ; f++) {
+        FFTMagnitudeWindow(&signal[f * frames->hop], check, frames->lenght, frames->window);
+        for (int k = 0 ; k < frames->lenght / 2 ; k++) {
+            TEST_ASSERT_FLOAT_WITHIN(1e-5 + 1e-5 * check[k], check[k], frames->frames[f][k]);
+        }
+    }
+}
+
+TEST_CASE("STFT functionality", "[stft]")
+{
+    stft_t stft_a;
+    stft_t stft_b;
+    TEST_ASSERT_TRUE(FFTInit());
+    TEST_ASSERT_FALSE(StftInit(&stft_a, 500, 100, FFT_HANN, store_frame, &frames_a));
+    TEST_ASSERT_FALSE(StftInit(&stft_a, 512, 0, FFT_HANN, store_frame, &frames_a));
+    TEST_ASSERT_TRUE(StftInit(&stft_a, frames_a.lenght, frames_a.hop, frames_a.window, store_frame, &frames_a));
+    TEST_ASSERT_TRUE(StftInit(&stft_b, frames_b.lenght, frames_b.hop, frames_b.window, store_frame, &frames_b));
+    for (int i = 0 ; i < SIG_LEN ; i++) {
+        signal[i] = sinf(0.05 * i * (1 + i / (float)SIG_LEN)) + 0.1 * ((float)rand() / RAND_MAX);
+    }
+    // Both instances fed alternately, in chunks of several lenghts
+    const int chunks[] = {1, 7, 300, 33, 1000, 129, 2, 4000};
+    int pushed = 0;
+    for (int c = 0 ; pushed < SIG_LEN ; c++) {
+        int n = chunks[c % 8];
+        if (pushed + n > SIG_LEN) {
+            n = SIG_LEN - pushed;
+        }
+        StftProcess(&stft_a, &signal[pushed], n);
+        StftProcess(&stft_b, &signal[pushed], n);
+        pushed += n;
+    }
+    check_frames(&frames_a);
+    check_frames(&frames_b);
+    TEST_ASSERT_EQUAL(frames_a.n_frames, stft_a.frames);
+    StftDeinit(&stft_a);
+    StftDeinit(&stft_b);
+}
@@ -0,0 +1,52 @@
+#include <stdio.h>
+#include <string.h>
+#include <setjmp.h>
+#include "unity.h"
+
+#define MAX_TESTS 256
+
+typedef struct {
+    const char *name;
+    unity_test_t test;
+} test_entry_t;
+
+static test_entry_t tests[MAX_TESTS];
+static int n_tests = 0;
+static jmp_buf test_abort;
+
+void UnityRegister(const char *name, unity_test_t test)
+{
+    if (n_tests < MAX_TESTS) {
+        tests[n_tests].name = name;
+        tests[n_tests].test = test;
+        n_tests++;
+    }
+}
+
+void UnityFail(const char *file, int line, const char *message)
+{
+    printf("%s:%d: FAIL: %s\n", file, line, message);
+    longjmp(test_abort, 1);
+}
+
+/* Runs every test case, or only the ones whose name contains argv[1] */
+int main(int argc, char *argv[])
+{
+    int run = 0;
+    int errors = 0;
+
+    for (int i = 0; i < n_tests; i++) {
+        if (argc > 1 && strstr(tests[i].name, argv[1]) == NULL) {
+            continue;
+        }
+        printf("%s\n", tests[i].name);
+        run++;
+        if (setjmp(test_abort) == 0) {
+            tests[i].test();
+        } else {
+            errors++;
+        }
+    }
+    printf("%d Tests %d Failures\n", run, errors);
+    return errors;
+}
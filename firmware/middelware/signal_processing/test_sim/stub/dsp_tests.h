@@ -0,0 +1,13 @@
+#ifndef _DSP_TESTS_H_
+#define _DSP_TESTS_H_
+
+#include <stdlib.h>
+#include "esp_log.h"
+
+/* The execution time limits hold on the ESP32 targets, on the host they are only reported */
+#define TEST_ASSERT_EXEC_IN_RANGE(min_exec, max_exec, actual) \
+    if ((actual) >= (max_exec) || (actual) < (min_exec)) { \
+        ESP_LOGW("", "Exec time %i out of [%i, %i)", (int)(actual), (int)(min_exec), (int)(max_exec)); \
+    }
+
+#endif // _DSP_TESTS_H_
@@ -0,0 +1 @@
+/* Not used by the signal processing modules on the host */
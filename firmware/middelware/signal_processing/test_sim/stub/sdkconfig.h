@@ -0,0 +1,6 @@
+#ifndef SDKCONFIG_H
+#define SDKCONFIG_H
+
+#define CONFIG_DSP_MAX_FFT_SIZE 4096
+
+#endif
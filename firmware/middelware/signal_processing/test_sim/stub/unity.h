@@ -0,0 +1,92 @@
+/**
+ * @file unity.h
+ * @author Albano Peñalva (albano.penalva@uner.edu.ar)
+ * @brief Subset of the Unity API used by the signal processing tests, to run them on the host
+ *
+ * Same semantics as Unity: the integer assertions cast both values to an integer and the
+ * first failed assertion ends the test case.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef UNITY_H
+#define UNITY_H
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <math.h>
+
+typedef void (*unity_test_t)(void);
+
+void UnityRegister(const char *name, unity_test_t test);
+void UnityFail(const char *file, int line, const char *message);
+
+#define UNITY_CAT_(a, b) a##b
+#define UNITY_CAT(a, b) UNITY_CAT_(a, b)
+
+#define TEST_CASE(name, tags) \
+    static void UNITY_CAT(test_, __LINE__)(void); \
+    __attribute__((constructor)) static void UNITY_CAT(register_, __LINE__)(void) \
+    { \
+        UnityRegister(name, UNITY_CAT(test_, __LINE__)); \
+    } \
+    static void UNITY_CAT(test_, __LINE__)(void)
+
+#define TEST_ASSERT_MESSAGE(condition, message) \
+    do { if (!(condition)) UnityFail(__FILE__, __LINE__, message); } while (0)
+#define TEST_ASSERT(condition)          TEST_ASSERT_MESSAGE(condition, #condition)
+#define TEST_ASSERT_TRUE(condition)     TEST_ASSERT_MESSAGE(condition, #condition)
+#define TEST_ASSERT_FALSE(condition)    TEST_ASSERT_MESSAGE(!(condition), "!(" #condition ")")
+#define TEST_ASSERT_NULL(pointer)       TEST_ASSERT_MESSAGE((pointer) == NULL, #pointer " == NULL")
+#define TEST_ASSERT_NOT_NULL(pointer)   TEST_ASSERT_MESSAGE((pointer) != NULL, #pointer " != NULL")
+#define TEST_ASSERT_EQUAL_PTR(expected, actual) \
+    TEST_ASSERT_MESSAGE((const void *)(expected) == (const void *)(actual), #expected " == " #actual)
+
+#define UNITY_INT_COMPARE(threshold, actual, op) \
+    do { \
+        long long threshold_ = (long long)(threshold); \
+        long long actual_ = (long long)(actual); \
+        if (!(actual_ op threshold_)) { \
+            printf("Expected " #actual " " #op " %lld, was %lld\n", threshold_, actual_); \
+            UnityFail(__FILE__, __LINE__, #actual " " #op " " #threshold); \
+        } \
+    } while (0)
+
+#define TEST_ASSERT_EQUAL(expected, actual)             UNITY_INT_COMPARE(expected, actual, ==)
+#define TEST_ASSERT_EQUAL_INT(expected, actual)         UNITY_INT_COMPARE(expected, actual, ==)
+#define TEST_ASSERT_EQUAL_INT16(expected, actual)       UNITY_INT_COMPARE((int16_t)(expected), (int16_t)(actual), ==)
+#define TEST_ASSERT_EQUAL_UINT16(expected, actual)      UNITY_INT_COMPARE((uint16_t)(expected), (uint16_t)(actual), ==)
+#define TEST_ASSERT_EQUAL_UINT32(expected, actual)      UNITY_INT_COMPARE((uint32_t)(expected), (uint32_t)(actual), ==)
+#define TEST_ASSERT_NOT_EQUAL(expected, actual)         UNITY_INT_COMPARE(expected, actual, !=)
+#define TEST_ASSERT_GREATER_THAN(threshold, actual)     UNITY_INT_COMPARE(threshold, actual, >)
+#define TEST_ASSERT_GREATER_OR_EQUAL(threshold, actual) UNITY_INT_COMPARE(threshold, actual, >=)
+#define TEST_ASSERT_LESS_THAN(threshold, actual)        UNITY_INT_COMPARE(threshold, actual, <)
+#define TEST_ASSERT_LESS_OR_EQUAL(threshold, actual)    UNITY_INT_COMPARE(threshold, actual, <=)
+
+#define TEST_ASSERT_INT_WITHIN(delta, expected, actual) \
+    do { \
+        long long diff_ = (long long)(actual) - (long long)(expected); \
+        if (llabs(diff_) > (long long)(delta)) { \
+            printf("Expected %lld +/- %lld, was %lld\n", (long long)(expected), (long long)(delta), (long long)(actual)); \
+            UnityFail(__FILE__, __LINE__, #actual " within " #delta " of " #expected); \
+        } \
+    } while (0)
+
+#define TEST_ASSERT_FLOAT_WITHIN(delta, expected, actual) \
+    do { \
+        float expected_ = (float)(expected); \
+        float actual_ = (float)(actual); \
+        if (!(expected_ == actual_ || fabsf(actual_ - expected_) <= fabsf((float)(delta)))) { \
+            printf("Expected %g +/- %g, was %g\n", expected_, fabsf((float)(delta)), actual_); \
+            UnityFail(__FILE__, __LINE__, #actual " within " #delta " of " #expected); \
+        } \
+    } while (0)
+#define TEST_ASSERT_EQUAL_FLOAT(expected, actual) \
+    TEST_ASSERT_FLOAT_WITHIN((float)(expected) * 0.00001f, expected, actual)
+
+#define TEST_ESP_OK(result)             TEST_ASSERT_EQUAL(ESP_OK, result)
+#define TEST_ESP_ERR(error, result)     TEST_ASSERT_EQUAL(error, result)
+
+#endif /* UNITY_H */